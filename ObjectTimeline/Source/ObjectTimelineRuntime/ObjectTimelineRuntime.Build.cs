@@ -17,6 +17,7 @@ public class ObjectTimelineRuntime : ModuleRules
 
 		PrivateDependencyModuleNames.AddRange(new string[]
 		{
+			"SignificanceManager",
 		});
 	}
 }
@@ -0,0 +1,5 @@
+#pragma once
+
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("ObjectTimeline"), STATGROUP_ObjectTimeline, STATCAT_Advanced);
@@ -1,20 +1,77 @@
 #include "TimelineObject.h"
+#include "ObjectTimelineStats.h"
+#include "TimelineObjectBakedCurve.h"
 #include "TimelineObjectBinding.h"
+#include "TimelineObjectFusedCurve.h"
+#include "TimelineObjectKeyCursor.h"
+#include "TimelineObjectSubsystem.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Engine/Engine.h"
 #include "Engine/NetDriver.h"
 #include "Engine/TimelineTemplate.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
-#include "GameFramework/WorldSettings.h"
-#include "Misc/App.h"
 #include "Net/UnrealNetwork.h"
 #include "Curves/CurveFloat.h"
 #include "Curves/CurveVector.h"
 #include "Curves/CurveLinearColor.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
+#include "HAL/IConsoleManager.h"
 #include "UObject/UObjectIterator.h"
 
-DECLARE_CYCLE_STAT(TEXT("TimelineObject Tick"), STAT_TimelineObjectTick, STATGROUP_Default);
+DECLARE_CYCLE_STAT(TEXT("TimelineObject Native Dispatch"), STAT_TimelineObjectNativeDispatch, STATGROUP_ObjectTimeline);
+DECLARE_CYCLE_STAT(TEXT("TimelineObject Dynamic Dispatch"), STAT_TimelineObjectDynamicDispatch, STATGROUP_ObjectTimeline);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Getter Cache Hits"), STAT_TimelineObjectGetterHits, STATGROUP_ObjectTimeline);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Getter Cache Misses"), STAT_TimelineObjectGetterMisses, STATGROUP_ObjectTimeline);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Event Checks Skipped"), STAT_TimelineObjectEventChecksSkipped, STATGROUP_ObjectTimeline);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Track Evaluations Skipped"), STAT_TimelineObjectTrackEvaluationsSkipped, STATGROUP_ObjectTimeline);
+
+static TAutoConsoleVariable<float> CVarTimelineObjectBakeCurveSampleRate(
+	TEXT("ObjectTimeline.BakeCurveSampleRate"),
+	0.f,
+	TEXT("Samples per second used to bake the tracks of timelines created from a template into shared lookup tables. 0 disables."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarTimelineObjectFusedEvaluation(
+	TEXT("ObjectTimeline.FusedEvaluation"),
+	1,
+	TEXT("Evaluate vector and linear color tracks through a merged key grid with one SIMD interpolation for all channels. Applies to tracks registered afterwards."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarTimelineObjectBakeCurveMinKeys(
+	TEXT("ObjectTimeline.BakeCurveMinKeys"),
+	8,
+	TEXT("Template tracks whose curves have fewer keys than this are evaluated directly instead of baked."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarTimelineObjectSkipUnobservedTracks(
+	TEXT("ObjectTimeline.SkipUnobservedTracks"),
+	1,
+	TEXT("Skip evaluating curve tracks that no delegate, track subscription, Blueprint pin or getter reads."),
+	ECVF_Default);
+
+namespace TimelineObjectCurveMemory
+{
+	/** Approximate bytes a curve asset keeps resident: the object itself plus its key arrays. */
+	static SIZE_T GetCurveAssetBytes(const UCurveBase* Curve)
+	{
+		SIZE_T Bytes = Curve->GetClass()->GetStructureSize();
+		for (const FRichCurveEditInfoConst& CurveInfo : Curve->GetCurves())
+		{
+			if (const FRichCurve* RichCurve = static_cast<const FRichCurve*>(CurveInfo.CurveToEdit))
+			{
+				Bytes += RichCurve->GetConstRefOfKeys().GetAllocatedSize();
+			}
+		}
+		return Bytes;
+	}
+
+	static FAutoConsoleCommandWithOutputDevice CurveMemoryReportCommand(
+		TEXT("ObjectTimeline.CurveMemoryReport"),
+		TEXT("Lists the curve assets referenced by live timelines with their resident size and the baked tables and fused grids built from them."),
+		FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&UTimelineObject::ReportCurveMemory));
+}
 
 #pragma region Constructor
 
@@ -37,27 +94,49 @@ UTimelineObject::UTimelineObject()
 
 void UTimelineObject::Play()
 {
+	bEventHorizonValid = false;
 	TheTimeline.Play();
+	EnsureEventBaseline();
+	UpdateTickActivation();
 }
 
 void UTimelineObject::PlayFromStart()
 {
-	TheTimeline.PlayFromStart();
+	// Restarting jumps back to the start without crossing any keys
+	DispatchPendingCallbacks();
+	bEventHorizonValid = false;
+	{
+		TGuardValue<bool> SeekGuard(bSeekingPlayback, true);
+		TheTimeline.PlayFromStart();
+	}
+	EnsureEventBaseline();
+	UpdateTickActivation();
 }
 
 void UTimelineObject::Reverse()
 {
+	bEventHorizonValid = false;
 	TheTimeline.Reverse();
+	EnsureEventBaseline();
+	UpdateTickActivation();
 }
 
 void UTimelineObject::ReverseFromEnd()
 {
-	TheTimeline.ReverseFromEnd();
+	DispatchPendingCallbacks();
+	bEventHorizonValid = false;
+	{
+		TGuardValue<bool> SeekGuard(bSeekingPlayback, true);
+		TheTimeline.ReverseFromEnd();
+	}
+	EnsureEventBaseline();
+	UpdateTickActivation();
 }
 
 void UTimelineObject::Stop()
 {
 	TheTimeline.Stop();
+	UpdateTickActivation();
 }
 
 bool UTimelineObject::IsPlaying() const
@@ -76,7 +155,25 @@ bool UTimelineObject::IsReversing() const
 
 void UTimelineObject::SetPlaybackPosition(float NewPosition, bool bFireEvents, bool bFireUpdate)
 {
+	// Updates still waiting for dispatch were not seeks. Values pre-evaluated by the tick manager are dropped,
+	// since a handler dispatched earlier in the bucket may have changed this timeline since.
+	bPendingValuesEvaluated = false;
+	DispatchPendingCallbacks();
+	ResetKeyCursors();
+	bEventHorizonValid = false;
+	TGuardValue<bool> SeekGuard(bSeekingPlayback, true);
+	TGuardValue<bool> SeekEventsGuard(bSeekFiresEvents, bFireEvents);
 	TheTimeline.SetPlaybackPosition(NewPosition, bFireEvents, bFireUpdate);
+
+	// Events are checked by the update, fire them here when no update ran
+	if (bFireEvents && !bFireUpdate)
+	{
+		CheckEventTracks(GetPlaybackPosition());
+	}
+
+	// Without an update the next tick would otherwise measure key crossings from before the seek
+	LastEventPosition = GetPlaybackPosition();
+	bHasEventBaseline = true;
 }
 
 float UTimelineObject::GetPlaybackPosition() const
@@ -86,9 +183,24 @@ float UTimelineObject::GetPlaybackPosition() const
 
 void UTimelineObject::SetNewTime(float NewTime)
 {
+	bPendingValuesEvaluated = false;
+	DispatchPendingCallbacks();
+	ResetKeyCursors();
+	bEventHorizonValid = false;
+	TGuardValue<bool> SeekGuard(bSeekingPlayback, true);
 	TheTimeline.SetNewTime(NewTime);
 }
 
+void UTimelineObject::SetSeekEventMode(ETimelineObjectSeekEvents NewMode)
+{
+	SeekEventMode = NewMode;
+}
+
+ETimelineObjectSeekEvents UTimelineObject::GetSeekEventMode() const
+{
+	return SeekEventMode;
+}
+
 float UTimelineObject::GetTimelineLength() const
 {
 	return TheTimeline.GetTimelineLength();
@@ -101,12 +213,53 @@ float UTimelineObject::GetScaledTimelineLength() const
 
 void UTimelineObject::SetTimelineLength(float NewLength)
 {
-	TheTimeline.SetTimelineLength(NewLength);
+	FixedTimelineLength = NewLength;
+	if (LengthMode != TL_LastKeyFrame)
+	{
+		TheTimeline.SetTimelineLength(NewLength);
+	}
 }
 
 void UTimelineObject::SetTimelineLengthMode(ETimelineLengthMode NewLengthMode)
 {
-	TheTimeline.SetTimelineLengthMode(NewLengthMode);
+	// FTimeline scans every track for the last keyframe on each tick in TL_LastKeyFrame mode,
+	// so it is given the resolved length instead
+	LengthMode = NewLengthMode;
+	TheTimeline.SetTimelineLengthMode(TL_TimelineLength);
+	if (LengthMode == TL_LastKeyFrame)
+	{
+		RefreshTimelineLength();
+	}
+	else
+	{
+		TheTimeline.SetTimelineLength(FixedTimelineLength);
+	}
+}
+
+void UTimelineObject::RefreshTimelineLength()
+{
+	if (LengthMode != TL_LastKeyFrame)
+	{
+		return;
+	}
+
+	// Interp curves of every track, including ones added through AddInterp*, plus event keys
+	TSet<UCurveBase*> Curves;
+	TheTimeline.GetAllCurves(Curves);
+	GetAllCurves(Curves);
+
+	float LastKeyframeTime = EventSchedule.Num() > 0 ? EventSchedule.Last().Time : 0.f;
+	for (const UCurveBase* Curve : Curves)
+	{
+		if (Curve)
+		{
+			float MinTime = 0.f;
+			float MaxTime = 0.f;
+			Curve->GetTimeRange(MinTime, MaxTime);
+			LastKeyframeTime = FMath::Max(LastKeyframeTime, MaxTime);
+		}
+	}
+	TheTimeline.SetTimelineLength(LastKeyframeTime);
 }
 
 #pragma endregion
@@ -125,6 +278,7 @@ bool UTimelineObject::IsLooping() const
 
 void UTimelineObject::SetPlayRate(float NewRate)
 {
+	bEventHorizonValid = false;
 	TheTimeline.SetPlayRate(NewRate);
 }
 
@@ -150,41 +304,357 @@ TEnumAsByte<ETimelineDirection::Type> UTimelineObject::GetPlaybackDirection() co
 
 #pragma endregion
 
+#pragma region Tick Settings
+
+void UTimelineObject::SetTickGroup(TEnumAsByte<ETickingGroup> NewTickGroup)
+{
+	const ETickingGroup SanitizedTickGroup = UTimelineObjectSubsystem::SanitizeTickGroup(NewTickGroup);
+	if (TickGroup == SanitizedTickGroup)
+	{
+		return;
+	}
+
+	UTimelineObjectSubsystem* Subsystem = TickSubsystem.Get();
+	if (!Subsystem)
+	{
+		TickGroup = SanitizedTickGroup;
+		return;
+	}
+
+	// Move active state and prerequisites over to the new bucket
+	const bool bWasActive = ActiveTimelineIndex != INDEX_NONE;
+	Subsystem->DeactivateTimeline(this);
+	for (const TWeakObjectPtr<AActor>& PrerequisiteActor : TickPrerequisiteActors)
+	{
+		Subsystem->RemoveBucketPrerequisite(TickGroup, PrerequisiteActor);
+	}
+
+	TickGroup = SanitizedTickGroup;
+
+	for (const TWeakObjectPtr<AActor>& PrerequisiteActor : TickPrerequisiteActors)
+	{
+		Subsystem->AddBucketPrerequisite(TickGroup, PrerequisiteActor.Get());
+	}
+	if (bWasActive)
+	{
+		Subsystem->ActivateTimeline(this);
+	}
+}
+
+TEnumAsByte<ETickingGroup> UTimelineObject::GetTickGroup() const
+{
+	return TickGroup;
+}
+
+void UTimelineObject::AddTickPrerequisiteActor(AActor* PrerequisiteActor)
+{
+	if (!PrerequisiteActor || TickPrerequisiteActors.Contains(PrerequisiteActor))
+	{
+		return;
+	}
+
+	TickPrerequisiteActors.Add(PrerequisiteActor);
+	if (UTimelineObjectSubsystem* Subsystem = TickSubsystem.Get())
+	{
+		Subsystem->AddBucketPrerequisite(TickGroup, PrerequisiteActor);
+	}
+}
+
+void UTimelineObject::RemoveTickPrerequisiteActor(AActor* PrerequisiteActor)
+{
+	if (TickPrerequisiteActors.Remove(PrerequisiteActor) > 0)
+	{
+		if (UTimelineObjectSubsystem* Subsystem = TickSubsystem.Get())
+		{
+			Subsystem->RemoveBucketPrerequisite(TickGroup, PrerequisiteActor);
+		}
+	}
+}
+
+void UTimelineObject::SetTickInterval(float NewTickInterval)
+{
+	NewTickInterval = FMath::Max(NewTickInterval, 0.f);
+	if (TickInterval == NewTickInterval)
+	{
+		return;
+	}
+
+	TickInterval = NewTickInterval;
+
+	// Re-stagger so timelines throttled together do not all update on the same frame
+	UTimelineObjectSubsystem* Subsystem = TickSubsystem.Get();
+	TimeUntilNextUpdate = (Subsystem && TickInterval > 0.f) ? Subsystem->GetStaggeredUpdateDelay(TickInterval) : 0.f;
+}
+
+float UTimelineObject::GetTickInterval() const
+{
+	return TickInterval;
+}
+
+void UTimelineObject::SetMaxUpdateRate(float MaxUpdateRate)
+{
+	SetTickInterval(MaxUpdateRate > 0.f ? 1.f / MaxUpdateRate : 0.f);
+}
+
+void UTimelineObject::SetFixedTimestep(float NewFixedTimestep, int32 NewMaxSubsteps)
+{
+	FixedTimestep = FMath::Max(NewFixedTimestep, 0.f);
+	MaxSubsteps = FMath::Max(NewMaxSubsteps, 1);
+	FixedStepRemainder = 0.f;
+}
+
+float UTimelineObject::GetFixedTimestep() const
+{
+	return FixedTimestep;
+}
+
+void UTimelineObject::SetUpdatePriority(ETimelineObjectPriority NewUpdatePriority)
+{
+	UpdatePriority = NewUpdatePriority;
+}
+
+ETimelineObjectPriority UTimelineObject::GetUpdatePriority() const
+{
+	return UpdatePriority;
+}
+
+void UTimelineObject::SetClockDomain(FName NewClockDomain)
+{
+	ClockDomain = NewClockDomain;
+	if (UTimelineObjectSubsystem* Subsystem = TickSubsystem.Get())
+	{
+		ClockDomainIndex = Subsystem->FindOrAddClockDomain(ClockDomain);
+	}
+}
+
+FName UTimelineObject::GetClockDomain() const
+{
+	return ClockDomain;
+}
+
+void UTimelineObject::SetLODSettings(const FTimelineObjectLODSettings& NewLODSettings)
+{
+	LODSettings = NewLODSettings;
+	TimeUntilLODUpdate = 0.f;
+	ResetLODIfUnused();
+}
+
+const FTimelineObjectLODSettings& UTimelineObject::GetLODSettings() const
+{
+	return LODSettings;
+}
+
+ETimelineObjectLOD UTimelineObject::GetCurrentLOD() const
+{
+	return CurrentLOD;
+}
+
+void UTimelineObject::SetSignificanceCallback(FTimelineObjectSignificanceDelegate NewSignificanceCallback)
+{
+	SignificanceCallback = NewSignificanceCallback;
+	TimeUntilLODUpdate = 0.f;
+	ResetLODIfUnused();
+}
+
+void UTimelineObject::SetSignificanceFunction(FTimelineObjectSignificanceDynamicDelegate NewSignificanceFunction)
+{
+	SignificanceFunction = NewSignificanceFunction;
+	TimeUntilLODUpdate = 0.f;
+	ResetLODIfUnused();
+}
+
+#pragma endregion
+
 #pragma region Curve Management
 
 void UTimelineObject::SetFloatCurve(UCurveFloat* NewFloatCurve, FName FloatTrackName)
 {
 	TheTimeline.SetFloatCurve(NewFloatCurve, FloatTrackName);
+	for (FTimelineObjectFloatTrack& Track : FloatTracks)
+	{
+		if (Track.TrackName == FloatTrackName)
+		{
+			Track.Curve = NewFloatCurve;
+			Track.KeyCursor = TimelineObjectKeyCursor::Invalid;
+		}
+	}
+	RefreshTrackEvaluators();
+	RefreshTimelineLength();
 }
 
 void UTimelineObject::SetVectorCurve(UCurveVector* NewVectorCurve, FName VectorTrackName)
 {
 	TheTimeline.SetVectorCurve(NewVectorCurve, VectorTrackName);
+	for (FTimelineObjectVectorTrack& Track : VectorTracks)
+	{
+		if (Track.TrackName == VectorTrackName)
+		{
+			Track.Curve = NewVectorCurve;
+			Track.KeyCursors[0] = Track.KeyCursors[1] = Track.KeyCursors[2] = TimelineObjectKeyCursor::Invalid;
+		}
+	}
+	RefreshTrackEvaluators();
+	RefreshTimelineLength();
 }
 
 void UTimelineObject::SetLinearColorCurve(UCurveLinearColor* NewLinearColorCurve, FName LinearColorTrackName)
 {
 	TheTimeline.SetLinearColorCurve(NewLinearColorCurve, LinearColorTrackName);
+	for (FTimelineObjectLinearColorTrack& Track : LinearColorTracks)
+	{
+		if (Track.TrackName == LinearColorTrackName)
+		{
+			Track.Curve = NewLinearColorCurve;
+		}
+	}
+	RefreshTrackEvaluators();
+	RefreshTimelineLength();
+}
+
+void UTimelineObject::SetCurveBakeSampleRate(float SampleRate)
+{
+	CurveBakeSampleRate = FMath::Max(SampleRate, 0.f);
+	CurveBakeMinKeys = 2;
+	RefreshTrackEvaluators();
+}
+
+float UTimelineObject::GetCurveBakeSampleRate() const
+{
+	return CurveBakeSampleRate;
+}
+
+float UTimelineObject::GetTrackBakeError(FName TrackName) const
+{
+	const FTimelineObjectBakedCurve* BakedCurve = nullptr;
+	if (const FTimelineObjectFloatTrack* FloatTrack = FloatTracks.FindByPredicate([TrackName](const FTimelineObjectFloatTrack& Track) { return Track.TrackName == TrackName; }))
+	{
+		BakedCurve = FloatTrack->BakedCurve.Get();
+	}
+	else if (const FTimelineObjectVectorTrack* VectorTrack = VectorTracks.FindByPredicate([TrackName](const FTimelineObjectVectorTrack& Track) { return Track.TrackName == TrackName; }))
+	{
+		BakedCurve = VectorTrack->BakedCurve.Get();
+	}
+	else if (const FTimelineObjectLinearColorTrack* ColorTrack = LinearColorTracks.FindByPredicate([TrackName](const FTimelineObjectLinearColorTrack& Track) { return Track.TrackName == TrackName; }))
+	{
+		BakedCurve = ColorTrack->BakedCurve.Get();
+	}
+	return BakedCurve ? BakedCurve->MaxError : 0.f;
+}
+
+void UTimelineObject::RefreshTrackEvaluators()
+{
+	// Values pre-evaluated for a pending update came from the previous curves
+	bTrackValuesValid = false;
+	bPendingValuesEvaluated = false;
+	GetterMemos.Reset();
+
+	// Short curves gain nothing from a table, their key search is already trivial
+	auto BakeCurve = [this](const UCurveBase* Curve) -> TSharedPtr<const FTimelineObjectBakedCurve>
+	{
+		if (!Curve || CurveBakeSampleRate <= 0.f)
+		{
+			return nullptr;
+		}
+
+		int32 NumKeys = 0;
+		for (const FRichCurveEditInfoConst& CurveInfo : Curve->GetCurves())
+		{
+			NumKeys = FMath::Max(NumKeys, CurveInfo.CurveToEdit ? CurveInfo.CurveToEdit->GetNumKeys() : 0);
+		}
+		return NumKeys >= CurveBakeMinKeys ? FTimelineObjectBakedCurveCache::FindOrBake(Curve, CurveBakeSampleRate) : nullptr;
+	};
+
+	// Multi-channel curves that are not baked share one key search across their channels
+	const bool bFuseChannels = CVarTimelineObjectFusedEvaluation.GetValueOnGameThread() != 0;
+	auto FuseCurve = [bFuseChannels](const TSharedPtr<const FTimelineObjectBakedCurve>& BakedCurve, const UCurveBase* Curve) -> TSharedPtr<const FTimelineObjectFusedCurve>
+	{
+		return (bFuseChannels && !BakedCurve && Curve) ? FTimelineObjectFusedCurveCache::FindOrBuild(Curve) : nullptr;
+	};
+
+	// Constant tracks take their value here and are skipped by every evaluation, the rest pick an evaluator per shape
+	for (FTimelineObjectFloatTrack& Track : FloatTracks)
+	{
+		Track.Shape = Track.Curve ? TimelineObjectKeyCursor::Classify(Track.Curve->FloatCurve) : ETimelineObjectCurveShape::General;
+		if (Track.Shape == ETimelineObjectCurveShape::Constant)
+		{
+			Track.Value = Track.Curve->GetFloatValue(0.f);
+			Track.BakedCurve = nullptr;
+		}
+		else
+		{
+			Track.BakedCurve = BakeCurve(Track.Curve);
+		}
+	}
+	for (FTimelineObjectVectorTrack& Track : VectorTracks)
+	{
+		Track.bConstant = Track.Curve != nullptr;
+		for (int32 Channel = 0; Channel < 3; ++Channel)
+		{
+			Track.Shapes[Channel] = Track.Curve ? TimelineObjectKeyCursor::Classify(Track.Curve->FloatCurves[Channel]) : ETimelineObjectCurveShape::General;
+			Track.bConstant &= Track.Shapes[Channel] == ETimelineObjectCurveShape::Constant;
+		}
+
+		if (Track.bConstant)
+		{
+			Track.Value = Track.Curve->GetVectorValue(0.f);
+			Track.BakedCurve = nullptr;
+			Track.FusedCurve = nullptr;
+		}
+		else
+		{
+			Track.BakedCurve = BakeCurve(Track.Curve);
+			Track.FusedCurve = FuseCurve(Track.BakedCurve, Track.Curve);
+		}
+		Track.FusedCursor = INDEX_NONE;
+	}
+	for (FTimelineObjectLinearColorTrack& Track : LinearColorTracks)
+	{
+		// Color adjustments are applied on top of the channels, which stays constant when the channels are
+		Track.bConstant = Track.Curve != nullptr;
+		for (int32 Channel = 0; Channel < 4 && Track.bConstant; ++Channel)
+		{
+			Track.bConstant &= TimelineObjectKeyCursor::Classify(Track.Curve->FloatCurves[Channel]) == ETimelineObjectCurveShape::Constant;
+		}
+
+		if (Track.bConstant)
+		{
+			Track.Value = Track.Curve->GetLinearColorValue(0.f);
+			Track.BakedCurve = nullptr;
+			Track.FusedCurve = nullptr;
+		}
+		else
+		{
+			Track.BakedCurve = BakeCurve(Track.Curve);
+			Track.FusedCurve = FuseCurve(Track.BakedCurve, Track.Curve);
+		}
+		Track.FusedCursor = INDEX_NONE;
+	}
 }
 
 void UTimelineObject::AddEvent(float Time, FOnTimelineEvent EventFunc)
 {
-	TheTimeline.AddEvent(Time, EventFunc);
+	// Kept out of FTimeline so all events are found by one search and fire in one deterministic order
+	AddedEvents.Emplace(Time, EventFunc);
+	RebuildEventSchedule();
+	RefreshTimelineLength();
 }
 
 void UTimelineObject::AddInterpVector(UCurveVector* VectorCurve, FOnTimelineVector InterpFunc, FName PropertyName, FName TrackName)
 {
 	TheTimeline.AddInterpVector(VectorCurve, InterpFunc, PropertyName, TrackName);
+	RefreshTimelineLength();
 }
 
 void UTimelineObject::AddInterpFloat(UCurveFloat* FloatCurve, FOnTimelineFloat InterpFunc, FName PropertyName, FName TrackName)
 {
 	TheTimeline.AddInterpFloat(FloatCurve, InterpFunc, PropertyName, TrackName);
+	RefreshTimelineLength();
 }
 
 void UTimelineObject::AddInterpLinearColor(UCurveLinearColor* LinearColorCurve, FOnTimelineLinearColor InterpFunc, FName PropertyName, FName TrackName)
 {
 	TheTimeline.AddInterpLinearColor(LinearColorCurve, InterpFunc, PropertyName, TrackName);
+	RefreshTimelineLength();
 }
 
 #pragma endregion
@@ -193,54 +663,168 @@ void UTimelineObject::AddInterpLinearColor(UCurveLinearColor* LinearColorCurve,
 
 float UTimelineObject::GetFloatValue(UCurveFloat* FloatCurve) const
 {
-	if (FloatCurve)
+	if (!FloatCurve)
+	{
+		return 0.f;
+	}
+
+	// Track pins read the value evaluated for this update instead of evaluating the curve again.
+	// A track skipped as unobserved is evaluated lazily by this read, and again by the next update.
+	for (const FTimelineObjectFloatTrack& Track : FloatTracks)
+	{
+		if (Track.Curve == FloatCurve)
+		{
+			// Keeps the track evaluated for the next update, whether this read hits the cached value or not
+			Track.bReadByGetter = true;
+			if (!Track.bSkipped && AreTrackValuesCurrent())
+			{
+				INC_DWORD_STAT(STAT_TimelineObjectGetterHits);
+				return Track.Value;
+			}
+			break;
+		}
+	}
+
+	// Any other curve is evaluated once per position, however many pins read it
+	if (const FVector4* Memo = FindGetterMemo(FloatCurve))
 	{
-		return FloatCurve->GetFloatValue(GetPlaybackPosition());
+		return static_cast<float>(Memo->X);
 	}
-	return 0.f;
+
+	const float Value = FloatCurve->GetFloatValue(GetPlaybackPosition());
+	AddGetterMemo(FloatCurve, FVector4(Value, 0.0, 0.0, 0.0));
+	return Value;
 }
 
 FVector UTimelineObject::GetVectorValue(UCurveVector* VectorCurve) const
 {
-	if (VectorCurve)
+	if (!VectorCurve)
+	{
+		return FVector::ZeroVector;
+	}
+
+	for (const FTimelineObjectVectorTrack& Track : VectorTracks)
 	{
-		return VectorCurve->GetVectorValue(GetPlaybackPosition());
+		if (Track.Curve == VectorCurve)
+		{
+			// Keeps the track evaluated for the next update, whether this read hits the cached value or not
+			Track.bReadByGetter = true;
+			if (!Track.bSkipped && AreTrackValuesCurrent())
+			{
+				INC_DWORD_STAT(STAT_TimelineObjectGetterHits);
+				return Track.Value;
+			}
+			break;
+		}
 	}
-	return FVector::ZeroVector;
+
+	if (const FVector4* Memo = FindGetterMemo(VectorCurve))
+	{
+		return FVector(*Memo);
+	}
+
+	const FVector Value = VectorCurve->GetVectorValue(GetPlaybackPosition());
+	AddGetterMemo(VectorCurve, FVector4(Value, 0.0));
+	return Value;
 }
 
 FLinearColor UTimelineObject::GetLinearColorValue(UCurveLinearColor* ColorCurve) const
 {
-	if (ColorCurve)
+	if (!ColorCurve)
+	{
+		return FLinearColor::Black;
+	}
+
+	for (const FTimelineObjectLinearColorTrack& Track : LinearColorTracks)
+	{
+		if (Track.Curve == ColorCurve)
+		{
+			// Keeps the track evaluated for the next update, whether this read hits the cached value or not
+			Track.bReadByGetter = true;
+			if (!Track.bSkipped && AreTrackValuesCurrent())
+			{
+				INC_DWORD_STAT(STAT_TimelineObjectGetterHits);
+				return Track.Value;
+			}
+			break;
+		}
+	}
+
+	if (const FVector4* Memo = FindGetterMemo(ColorCurve))
+	{
+		return FLinearColor(static_cast<float>(Memo->X), static_cast<float>(Memo->Y), static_cast<float>(Memo->Z), static_cast<float>(Memo->W));
+	}
+
+	const FLinearColor Value = ColorCurve->GetLinearColorValue(GetPlaybackPosition());
+	AddGetterMemo(ColorCurve, FVector4(Value.R, Value.G, Value.B, Value.A));
+	return Value;
+}
+
+bool UTimelineObject::AreTrackValuesCurrent() const
+{
+	return bTrackValuesValid && TrackValuesPosition == GetPlaybackPosition();
+}
+
+const FVector4* UTimelineObject::FindGetterMemo(const UCurveBase* Curve) const
+{
+	// Memos only live as long as the playback position they were computed at
+	const float Position = GetPlaybackPosition();
+	if (GetterMemoPosition != Position)
+	{
+		GetterMemos.Reset();
+		GetterMemoPosition = Position;
+	}
+
+	for (const FTimelineObjectGetterMemo& Memo : GetterMemos)
 	{
-		return ColorCurve->GetLinearColorValue(GetPlaybackPosition());
+		if (Memo.Curve == Curve)
+		{
+			INC_DWORD_STAT(STAT_TimelineObjectGetterHits);
+			return &Memo.Value;
+		}
 	}
-	return FLinearColor::Black;
+
+	INC_DWORD_STAT(STAT_TimelineObjectGetterMisses);
+	return nullptr;
+}
+
+void UTimelineObject::AddGetterMemo(const UCurveBase* Curve, const FVector4& Value) const
+{
+	GetterMemos.Add({ Curve, Value });
 }
 
 UCurveFloat* UTimelineObject::GetFloatTrackCurve(FName TrackName) const
 {
-	if (const TObjectPtr<UCurveFloat>* Found = FloatTrackCurves.Find(TrackName))
+	for (const FTimelineObjectFloatTrack& Track : FloatTracks)
 	{
-		return *Found;
+		if (Track.TrackName == TrackName)
+		{
+			return Track.Curve;
+		}
 	}
 	return nullptr;
 }
 
 UCurveVector* UTimelineObject::GetVectorTrackCurve(FName TrackName) const
 {
-	if (const TObjectPtr<UCurveVector>* Found = VectorTrackCurves.Find(TrackName))
+	for (const FTimelineObjectVectorTrack& Track : VectorTracks)
 	{
-		return *Found;
+		if (Track.TrackName == TrackName)
+		{
+			return Track.Curve;
+		}
 	}
 	return nullptr;
 }
 
 UCurveLinearColor* UTimelineObject::GetLinearColorTrackCurve(FName TrackName) const
 {
-	if (const TObjectPtr<UCurveLinearColor>* Found = LinearColorTrackCurves.Find(TrackName))
+	for (const FTimelineObjectLinearColorTrack& Track : LinearColorTracks)
 	{
-		return *Found;
+		if (Track.TrackName == TrackName)
+		{
+			return Track.Curve;
+		}
 	}
 	return nullptr;
 }
@@ -256,17 +840,17 @@ void UTimelineObject::SetPropertySetObject(UObject* NewPropertySetObject)
 
 void UTimelineObject::SetTimelinePostUpdateFunc(FOnTimelineEvent NewTimelinePostUpdateFunc)
 {
-	TheTimeline.SetTimelinePostUpdateFunc(NewTimelinePostUpdateFunc);
+	UserPostUpdateFunc = NewTimelinePostUpdateFunc;
 }
 
 void UTimelineObject::SetTimelineFinishedFunc(FOnTimelineEvent NewTimelineFinishedFunc)
 {
-	TheTimeline.SetTimelineFinishedFunc(NewTimelineFinishedFunc);
+	UserFinishedFunc = NewTimelineFinishedFunc;
 }
 
 void UTimelineObject::SetTimelineFinishedFunc(FOnTimelineEventStatic NewTimelineFinishedFunc)
 {
-	TheTimeline.SetTimelineFinishedFunc(NewTimelineFinishedFunc);
+	UserFinishedFuncStatic = NewTimelineFinishedFunc;
 }
 
 void UTimelineObject::SetDirectionPropertyName(FName DirectionPropertyName)
@@ -280,46 +864,124 @@ void UTimelineObject::SetDirectionPropertyName(FName DirectionPropertyName)
 
 void UTimelineObject::GetAllCurves(TSet<class UCurveBase*>& InOutCurves) const
 {
-	for (const auto& Pair : FloatTrackCurves)
+	for (const FTimelineObjectFloatTrack& Track : FloatTracks)
 	{
-		if (Pair.Value)
+		if (Track.Curve)
 		{
-			InOutCurves.Add(Pair.Value);
+			InOutCurves.Add(Track.Curve);
 		}
 	}
 
-	for (const auto& Pair : VectorTrackCurves)
+	for (const FTimelineObjectVectorTrack& Track : VectorTracks)
 	{
-		if (Pair.Value)
+		if (Track.Curve)
 		{
-			InOutCurves.Add(Pair.Value);
+			InOutCurves.Add(Track.Curve);
 		}
 	}
 
-	for (const auto& Pair : LinearColorTrackCurves)
+	for (const FTimelineObjectLinearColorTrack& Track : LinearColorTracks)
 	{
-		if (Pair.Value)
+		if (Track.Curve)
 		{
-			InOutCurves.Add(Pair.Value);
+			InOutCurves.Add(Track.Curve);
 		}
 	}
 
-	for (const auto& Pair : EventTrackCurves)
+	for (const FTimelineObjectEventTrack& Track : EventTracks)
 	{
-		if (Pair.Value)
+		if (Track.Curve)
 		{
-			InOutCurves.Add(Pair.Value);
+			InOutCurves.Add(Track.Curve);
 		}
 	}
 }
 
-AActor* UTimelineObject::GetOwningActor() const
+void UTimelineObject::ReportCurveMemory(FOutputDevice& Ar)
 {
-	return GetTypedOuter<AActor>();
-}
+	using namespace TimelineObjectCurveMemory;
 
-UTimelineObject* UTimelineObject::GetOrCreateTimelineObject(UObject* Owner, FName TimelineName, FName UpdateFuncName, FName FinishedFuncName)
-{
+	TMap<const UCurveBase*, SIZE_T> RuntimeBytesByCurve;
+	TSet<const void*> CountedTables;
+	auto AddTable = [&RuntimeBytesByCurve, &CountedTables](const UCurveBase* Curve, const void* Table, SIZE_T Bytes)
+	{
+		bool bAlreadyCounted = false;
+		CountedTables.Add(Table, &bAlreadyCounted);
+		if (!bAlreadyCounted)
+		{
+			RuntimeBytesByCurve.FindOrAdd(Curve) += Bytes;
+		}
+	};
+
+	for (TObjectIterator<UTimelineObject> It(RF_ClassDefaultObject | RF_ArchetypeObject); It; ++It)
+	{
+		const UTimelineObject* Timeline = *It;
+		for (const FTimelineObjectFloatTrack& Track : Timeline->FloatTracks)
+		{
+			RuntimeBytesByCurve.FindOrAdd(Track.Curve);
+			if (Track.BakedCurve)
+			{
+				AddTable(Track.Curve, Track.BakedCurve.Get(), Track.BakedCurve->GetAllocatedSize());
+			}
+		}
+		for (const FTimelineObjectVectorTrack& Track : Timeline->VectorTracks)
+		{
+			RuntimeBytesByCurve.FindOrAdd(Track.Curve);
+			if (Track.BakedCurve)
+			{
+				AddTable(Track.Curve, Track.BakedCurve.Get(), Track.BakedCurve->GetAllocatedSize());
+			}
+			if (Track.FusedCurve)
+			{
+				AddTable(Track.Curve, Track.FusedCurve.Get(), Track.FusedCurve->GetAllocatedSize());
+			}
+		}
+		for (const FTimelineObjectLinearColorTrack& Track : Timeline->LinearColorTracks)
+		{
+			RuntimeBytesByCurve.FindOrAdd(Track.Curve);
+			if (Track.BakedCurve)
+			{
+				AddTable(Track.Curve, Track.BakedCurve.Get(), Track.BakedCurve->GetAllocatedSize());
+			}
+			if (Track.FusedCurve)
+			{
+				AddTable(Track.Curve, Track.FusedCurve.Get(), Track.FusedCurve->GetAllocatedSize());
+			}
+		}
+		for (const FTimelineObjectEventTrack& Track : Timeline->EventTracks)
+		{
+			RuntimeBytesByCurve.FindOrAdd(Track.Curve);
+		}
+	}
+
+	SIZE_T TotalAssetBytes = 0;
+	SIZE_T TotalRuntimeBytes = 0;
+	int32 NumCurves = 0;
+	for (const TPair<const UCurveBase*, SIZE_T>& Pair : RuntimeBytesByCurve)
+	{
+		if (!Pair.Key)
+		{
+			continue;
+		}
+
+		const SIZE_T AssetBytes = GetCurveAssetBytes(Pair.Key);
+		Ar.Logf(TEXT("%s: %llu bytes as asset, %llu bytes in baked tables and fused grids"),
+			*Pair.Key->GetPathName(), static_cast<uint64>(AssetBytes), static_cast<uint64>(Pair.Value));
+		TotalAssetBytes += AssetBytes;
+		TotalRuntimeBytes += Pair.Value;
+		++NumCurves;
+	}
+	Ar.Logf(TEXT("%d curves: %llu bytes evaluated directly, %llu bytes with baked tables and fused grids (curve assets stay resident either way)"),
+		NumCurves, static_cast<uint64>(TotalAssetBytes), static_cast<uint64>(TotalAssetBytes + TotalRuntimeBytes));
+}
+
+AActor* UTimelineObject::GetOwningActor() const
+{
+	return GetTypedOuter<AActor>();
+}
+
+UTimelineObject* UTimelineObject::GetOrCreateTimelineObject(UObject* Owner, FName TimelineName, FName UpdateFuncName, FName FinishedFuncName)
+{
 	if (!Owner)
 	{
 		return nullptr;
@@ -359,6 +1021,7 @@ UTimelineObject* UTimelineObject::GetOrCreateTimelineObject(UObject* Owner, FNam
 	if (UWorld* World = Owner->GetWorld())
 	{
 		NewTimeline->CachedWorld = World;
+		NewTimeline->RegisterWithTickSubsystem();
 	}
 
 	// Initialize from UTimelineTemplate in BPGC->Timelines (works in both editor and runtime)
@@ -403,6 +1066,10 @@ UTimelineObject* UTimelineObject::GetOrCreateTimelineObject(UObject* Owner, FNam
 								NewTimeline->BindEventTrackFunction(TrackPair.Key, Owner, TrackPair.Value);
 							}
 						}
+						for (FName TrackName : Entry.ReadTrackNames)
+						{
+							NewTimeline->AddTrackPinReader(TrackName);
+						}
 						break;
 					}
 				}
@@ -434,6 +1101,7 @@ void UTimelineObject::InitializeFromTemplate(UTimelineTemplate* Template)
 	SetLooping(Template->bLoop);
 	SetPlayRate(1.0f);
 	SetIgnoreTimeDilation(Template->bIgnoreTimeDilation);
+	SetTickGroup(Template->TimelineTickGroup);
 
 	// Initialize float tracks
 	for (const FTTFloatTrack& Track : Template->FloatTracks)
@@ -441,7 +1109,9 @@ void UTimelineObject::InitializeFromTemplate(UTimelineTemplate* Template)
 		if (Track.CurveFloat)
 		{
 			FName TrackName = Track.GetTrackName();
-			FloatTrackCurves.Add(TrackName, Track.CurveFloat);
+			FTimelineObjectFloatTrack& FloatTrack = FloatTracks.AddDefaulted_GetRef();
+			FloatTrack.TrackName = TrackName;
+			FloatTrack.Curve = Track.CurveFloat;
 			FOnTimelineFloat InterpDelegate;
 			TheTimeline.AddInterpFloat(Track.CurveFloat, InterpDelegate, NAME_None, TrackName);
 		}
@@ -453,7 +1123,9 @@ void UTimelineObject::InitializeFromTemplate(UTimelineTemplate* Template)
 		if (Track.CurveVector)
 		{
 			FName TrackName = Track.GetTrackName();
-			VectorTrackCurves.Add(TrackName, Track.CurveVector);
+			FTimelineObjectVectorTrack& VectorTrack = VectorTracks.AddDefaulted_GetRef();
+			VectorTrack.TrackName = TrackName;
+			VectorTrack.Curve = Track.CurveVector;
 			FOnTimelineVector InterpDelegate;
 			TheTimeline.AddInterpVector(Track.CurveVector, InterpDelegate, NAME_None, TrackName);
 		}
@@ -465,12 +1137,23 @@ void UTimelineObject::InitializeFromTemplate(UTimelineTemplate* Template)
 		if (Track.CurveLinearColor)
 		{
 			FName TrackName = Track.GetTrackName();
-			LinearColorTrackCurves.Add(TrackName, Track.CurveLinearColor);
+			FTimelineObjectLinearColorTrack& LinearColorTrack = LinearColorTracks.AddDefaulted_GetRef();
+			LinearColorTrack.TrackName = TrackName;
+			LinearColorTrack.Curve = Track.CurveLinearColor;
 			FOnTimelineLinearColor InterpDelegate;
 			TheTimeline.AddInterpLinearColor(Track.CurveLinearColor, InterpDelegate, NAME_None, TrackName);
 		}
 	}
 
+	// Bake hot tracks into shared lookup tables when enabled project-wide
+	const float BakeSampleRate = CVarTimelineObjectBakeCurveSampleRate.GetValueOnGameThread();
+	if (BakeSampleRate > 0.f)
+	{
+		CurveBakeSampleRate = BakeSampleRate;
+		CurveBakeMinKeys = FMath::Max(CVarTimelineObjectBakeCurveMinKeys.GetValueOnGameThread(), 2);
+	}
+	RefreshTrackEvaluators();
+
 	// Initialize event tracks
 	for (const FTTEventTrack& Track : Template->EventTracks)
 	{
@@ -480,6 +1163,7 @@ void UTimelineObject::InitializeFromTemplate(UTimelineTemplate* Template)
 			RegisterEventTrack(TrackName, Track.CurveKeys);
 		}
 	}
+	RefreshTimelineLength();
 
 	// Defer autoplay until after delegates are bound
 	if (Template->bAutoPlay)
@@ -497,6 +1181,11 @@ FOnTimelineObjectEvent& UTimelineObject::GetEventTrackDelegate(FName TrackName)
 	return EventTrackDelegates.FindOrAdd(TrackName);
 }
 
+FOnTimelineObjectEventNative& UTimelineObject::GetEventTrackNativeDelegate(FName TrackName)
+{
+	return EventTrackNativeDelegates.FindOrAdd(TrackName);
+}
+
 void UTimelineObject::RemoveAllDelegatesForObject(UObject* BoundObject)
 {
 	if (!BoundObject)
@@ -517,6 +1206,46 @@ void UTimelineObject::RemoveAllDelegatesForObject(UObject* BoundObject)
 		Pair.Value.RemoveAll(BoundObject);
 	}
 
+	// Remove from native delegates bound to the object
+	OnTimelineUpdateNative.RemoveAll(BoundObject);
+	OnTimelineFinishedNative.RemoveAll(BoundObject);
+	OnFloatTrackNativeDelegate.RemoveAll(BoundObject);
+	OnVectorTrackNativeDelegate.RemoveAll(BoundObject);
+	OnLinearColorTrackNativeDelegate.RemoveAll(BoundObject);
+	for (auto& Pair : EventTrackNativeDelegates)
+	{
+		Pair.Value.RemoveAll(BoundObject);
+	}
+
+	// Remove from per-track subscriptions
+	for (FTimelineObjectFloatTrack& Track : FloatTracks)
+	{
+		Track.NativeSubscribers.RemoveAll(BoundObject);
+		Track.DynamicSubscribers.RemoveAll(BoundObject);
+	}
+	for (FTimelineObjectVectorTrack& Track : VectorTracks)
+	{
+		Track.NativeSubscribers.RemoveAll(BoundObject);
+		Track.DynamicSubscribers.RemoveAll(BoundObject);
+	}
+	for (FTimelineObjectLinearColorTrack& Track : LinearColorTracks)
+	{
+		Track.NativeSubscribers.RemoveAll(BoundObject);
+		Track.DynamicSubscribers.RemoveAll(BoundObject);
+	}
+	// Drop the handles of the listeners removed above, and of any whose object is already gone
+	for (auto It = TrackSubscriptions.CreateIterator(); It; ++It)
+	{
+		const FTimelineObjectTrackSubscription& Subscription = It->Value;
+		const bool bNative = Subscription.NativeHandle.IsValid();
+		const UObject* Owner = bNative ? Subscription.NativeOwner.Get() : Subscription.DynamicDelegate.GetUObject();
+		const bool bOwnerGone = bNative ? Subscription.NativeOwner.IsStale() : !Subscription.DynamicDelegate.IsBound();
+		if (Owner == BoundObject || bOwnerGone)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
 	// Clean up bound function tracking
 	for (auto It = BoundUpdateFunctions.CreateIterator(); It; ++It)
 	{
@@ -548,9 +1277,261 @@ void UTimelineObject::RegisterEventTrack(FName TrackName, UCurveFloat* EventCurv
 {
 	if (TrackName != NAME_None && EventCurve)
 	{
-		EventTrackCurves.Add(TrackName, EventCurve);
+		FTimelineObjectEventTrack* Track = EventTracks.FindByPredicate([TrackName](const FTimelineObjectEventTrack& Existing) { return Existing.TrackName == TrackName; });
+		if (!Track)
+		{
+			Track = &EventTracks.AddDefaulted_GetRef();
+			Track->TrackName = TrackName;
+		}
+		Track->Curve = EventCurve;
+
 		EventTrackDelegates.FindOrAdd(TrackName);
-		LastEventTrackPositions.Add(TrackName, -1.0f);
+		RebuildEventSchedule();
+		RefreshTimelineLength();
+	}
+}
+
+#pragma endregion
+
+#pragma region Track Subscriptions
+
+namespace TimelineObjectSubscriptions
+{
+	template <typename TrackType>
+	static TrackType* FindTrack(TArray<TrackType>& Tracks, FName TrackName)
+	{
+		return TrackName != NAME_None ? Tracks.FindByPredicate([TrackName](const TrackType& Track) { return Track.TrackName == TrackName; }) : nullptr;
+	}
+
+	/** Whether anything reads the track besides the global track delegates */
+	template <typename TrackType>
+	static bool IsObserved(const TrackType& Track)
+	{
+		return Track.PinReaders > 0 || Track.bReadByGetter || Track.NativeSubscribers.IsBound() || Track.DynamicSubscribers.IsBound();
+	}
+
+	template <typename TrackType>
+	static bool AddPinReader(TArray<TrackType>& Tracks, FName TrackName)
+	{
+		if (TrackType* Track = FindTrack(Tracks, TrackName))
+		{
+			++Track->PinReaders;
+			return true;
+		}
+		return false;
+	}
+}
+
+FTimelineObjectTrackHandle UTimelineObject::BindFloatTrack(FName TrackName, FOnTimelineObjectFloatValue Delegate)
+{
+	FTimelineObjectFloatTrack* Track = TimelineObjectSubscriptions::FindTrack(FloatTracks, TrackName);
+	if (!Track || !Delegate.IsBound())
+	{
+		return FTimelineObjectTrackHandle();
+	}
+
+	// Binding the same function twice hands back the first binding's handle, one UnbindTrack removes it
+	if (!Track->DynamicSubscribers.Contains(Delegate))
+	{
+		Track->DynamicSubscribers.Add(Delegate);
+	}
+	return FindOrAddDynamicTrackSubscription(TrackName, ETimelineObjectTrackType::Float, Delegate);
+}
+
+FTimelineObjectTrackHandle UTimelineObject::BindVectorTrack(FName TrackName, FOnTimelineObjectVectorValue Delegate)
+{
+	FTimelineObjectVectorTrack* Track = TimelineObjectSubscriptions::FindTrack(VectorTracks, TrackName);
+	if (!Track || !Delegate.IsBound())
+	{
+		return FTimelineObjectTrackHandle();
+	}
+
+	// Binding the same function twice hands back the first binding's handle, one UnbindTrack removes it
+	if (!Track->DynamicSubscribers.Contains(Delegate))
+	{
+		Track->DynamicSubscribers.Add(Delegate);
+	}
+	return FindOrAddDynamicTrackSubscription(TrackName, ETimelineObjectTrackType::Vector, Delegate);
+}
+
+FTimelineObjectTrackHandle UTimelineObject::BindLinearColorTrack(FName TrackName, FOnTimelineObjectLinearColorValue Delegate)
+{
+	FTimelineObjectLinearColorTrack* Track = TimelineObjectSubscriptions::FindTrack(LinearColorTracks, TrackName);
+	if (!Track || !Delegate.IsBound())
+	{
+		return FTimelineObjectTrackHandle();
+	}
+
+	// Binding the same function twice hands back the first binding's handle, one UnbindTrack removes it
+	if (!Track->DynamicSubscribers.Contains(Delegate))
+	{
+		Track->DynamicSubscribers.Add(Delegate);
+	}
+	return FindOrAddDynamicTrackSubscription(TrackName, ETimelineObjectTrackType::LinearColor, Delegate);
+}
+
+FTimelineObjectTrackHandle UTimelineObject::AddFloatTrackListener(FName TrackName, FOnTimelineObjectFloatValueNative::FDelegate Delegate)
+{
+	FTimelineObjectFloatTrack* Track = TimelineObjectSubscriptions::FindTrack(FloatTracks, TrackName);
+	if (!Track || !Delegate.IsBound())
+	{
+		return FTimelineObjectTrackHandle();
+	}
+
+	const UObject* NativeOwner = Delegate.GetUObject();
+	const FDelegateHandle NativeHandle = Track->NativeSubscribers.Add(MoveTemp(Delegate));
+	return AddTrackSubscription(TrackName, ETimelineObjectTrackType::Float, NativeHandle, NativeOwner, FScriptDelegate());
+}
+
+FTimelineObjectTrackHandle UTimelineObject::AddVectorTrackListener(FName TrackName, FOnTimelineObjectVectorValueNative::FDelegate Delegate)
+{
+	FTimelineObjectVectorTrack* Track = TimelineObjectSubscriptions::FindTrack(VectorTracks, TrackName);
+	if (!Track || !Delegate.IsBound())
+	{
+		return FTimelineObjectTrackHandle();
+	}
+
+	const UObject* NativeOwner = Delegate.GetUObject();
+	const FDelegateHandle NativeHandle = Track->NativeSubscribers.Add(MoveTemp(Delegate));
+	return AddTrackSubscription(TrackName, ETimelineObjectTrackType::Vector, NativeHandle, NativeOwner, FScriptDelegate());
+}
+
+FTimelineObjectTrackHandle UTimelineObject::AddLinearColorTrackListener(FName TrackName, FOnTimelineObjectLinearColorValueNative::FDelegate Delegate)
+{
+	FTimelineObjectLinearColorTrack* Track = TimelineObjectSubscriptions::FindTrack(LinearColorTracks, TrackName);
+	if (!Track || !Delegate.IsBound())
+	{
+		return FTimelineObjectTrackHandle();
+	}
+
+	const UObject* NativeOwner = Delegate.GetUObject();
+	const FDelegateHandle NativeHandle = Track->NativeSubscribers.Add(MoveTemp(Delegate));
+	return AddTrackSubscription(TrackName, ETimelineObjectTrackType::LinearColor, NativeHandle, NativeOwner, FScriptDelegate());
+}
+
+void UTimelineObject::UnbindTrack(FTimelineObjectTrackHandle& Handle)
+{
+	FTimelineObjectTrackSubscription Subscription;
+	if (!Handle.IsValid() || !TrackSubscriptions.RemoveAndCopyValue(Handle.Id, Subscription))
+	{
+		Handle = FTimelineObjectTrackHandle();
+		return;
+	}
+	Handle = FTimelineObjectTrackHandle();
+
+	// The track may have been replaced since, in which case its listeners went with it
+	auto RemoveFrom = [&Subscription](auto* Track)
+	{
+		if (Track)
+		{
+			if (Subscription.NativeHandle.IsValid())
+			{
+				Track->NativeSubscribers.Remove(Subscription.NativeHandle);
+			}
+			else
+			{
+				Track->DynamicSubscribers.Remove(Subscription.DynamicDelegate);
+			}
+		}
+	};
+
+	switch (Subscription.TrackType)
+	{
+	case ETimelineObjectTrackType::Float:
+		RemoveFrom(TimelineObjectSubscriptions::FindTrack(FloatTracks, Subscription.TrackName));
+		break;
+	case ETimelineObjectTrackType::Vector:
+		RemoveFrom(TimelineObjectSubscriptions::FindTrack(VectorTracks, Subscription.TrackName));
+		break;
+	case ETimelineObjectTrackType::LinearColor:
+		RemoveFrom(TimelineObjectSubscriptions::FindTrack(LinearColorTracks, Subscription.TrackName));
+		break;
+	}
+}
+
+void UTimelineObject::AddTrackPinReader(FName TrackName)
+{
+	using namespace TimelineObjectSubscriptions;
+	AddPinReader(FloatTracks, TrackName) || AddPinReader(VectorTracks, TrackName) || AddPinReader(LinearColorTracks, TrackName);
+}
+
+FTimelineObjectTrackHandle UTimelineObject::AddTrackSubscription(FName TrackName, ETimelineObjectTrackType TrackType, FDelegateHandle NativeHandle, const UObject* NativeOwner, const FScriptDelegate& DynamicDelegate)
+{
+	FTimelineObjectTrackHandle Handle;
+	Handle.Id = NextTrackHandleId++;
+
+	FTimelineObjectTrackSubscription& Subscription = TrackSubscriptions.Add(Handle.Id);
+	Subscription.TrackName = TrackName;
+	Subscription.TrackType = TrackType;
+	Subscription.NativeHandle = NativeHandle;
+	Subscription.NativeOwner = NativeOwner;
+	Subscription.DynamicDelegate = DynamicDelegate;
+	return Handle;
+}
+
+FTimelineObjectTrackHandle UTimelineObject::FindOrAddDynamicTrackSubscription(FName TrackName, ETimelineObjectTrackType TrackType, const FScriptDelegate& Delegate)
+{
+	for (const TPair<int32, FTimelineObjectTrackSubscription>& Pair : TrackSubscriptions)
+	{
+		const FTimelineObjectTrackSubscription& Subscription = Pair.Value;
+		if (!Subscription.NativeHandle.IsValid() && Subscription.TrackType == TrackType && Subscription.TrackName == TrackName && Subscription.DynamicDelegate == Delegate)
+		{
+			FTimelineObjectTrackHandle Handle;
+			Handle.Id = Pair.Key;
+			return Handle;
+		}
+	}
+	return AddTrackSubscription(TrackName, TrackType, FDelegateHandle(), nullptr, Delegate);
+}
+
+void UTimelineObject::BroadcastTrackSubscribers(bool bNative) const
+{
+	// Each track calls only its own listeners, so tracks nobody listens to cost one check.
+	// Tracks skipped by the last evaluation are picked up from the next update, when their values are current.
+	for (const FTimelineObjectFloatTrack& Track : FloatTracks)
+	{
+		if (!Track.Curve || Track.bSkipped)
+		{
+			continue;
+		}
+		if (bNative)
+		{
+			Track.NativeSubscribers.Broadcast(Track.Value);
+		}
+		else if (Track.DynamicSubscribers.IsBound())
+		{
+			Track.DynamicSubscribers.Broadcast(Track.Value);
+		}
+	}
+	for (const FTimelineObjectVectorTrack& Track : VectorTracks)
+	{
+		if (!Track.Curve || Track.bSkipped)
+		{
+			continue;
+		}
+		if (bNative)
+		{
+			Track.NativeSubscribers.Broadcast(Track.Value);
+		}
+		else if (Track.DynamicSubscribers.IsBound())
+		{
+			Track.DynamicSubscribers.Broadcast(Track.Value);
+		}
+	}
+	for (const FTimelineObjectLinearColorTrack& Track : LinearColorTracks)
+	{
+		if (!Track.Curve || Track.bSkipped)
+		{
+			continue;
+		}
+		if (bNative)
+		{
+			Track.NativeSubscribers.Broadcast(Track.Value);
+		}
+		else if (Track.DynamicSubscribers.IsBound())
+		{
+			Track.DynamicSubscribers.Broadcast(Track.Value);
+		}
 	}
 }
 
@@ -633,57 +1614,102 @@ void UTimelineObject::BindEventTrackFunction(FName TrackName, UObject* Target, F
 
 #pragma endregion
 
-#pragma region FTickableGameObject Interface
+#pragma region Tick Registration
 
-void UTimelineObject::Tick(float DeltaTime)
+UWorld* UTimelineObject::GetTickWorld() const
 {
-	SCOPE_CYCLE_COUNTER(STAT_TimelineObjectTick);
+	// Prefer cached world for reliable ticking with non-Actor owners
+	if (CachedWorld.IsValid())
+	{
+		return CachedWorld.Get();
+	}
+	return GetWorld();
+}
 
-	// Use undilated time if configured to ignore time dilation
-	if (bIgnoreTimeDilation)
+void UTimelineObject::RegisterWithTickSubsystem()
+{
+	if (TickSubsystem.IsValid() || HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
 	{
-		DeltaTime = FApp::GetDeltaTime();
+		return;
+	}
 
-		if (const UWorld* World = GetWorld())
+	if (UWorld* World = GetTickWorld())
+	{
+		if (UTimelineObjectSubsystem* Subsystem = World->GetSubsystem<UTimelineObjectSubsystem>())
 		{
-			if (const AWorldSettings* WorldSettings = World->GetWorldSettings())
+			Subsystem->RegisterTimeline(this);
+			TickSubsystem = Subsystem;
+			ClockDomainIndex = Subsystem->FindOrAddClockDomain(ClockDomain);
+
+			for (const TWeakObjectPtr<AActor>& PrerequisiteActor : TickPrerequisiteActors)
 			{
-				DeltaTime = FMath::Clamp(DeltaTime, WorldSettings->MinUndilatedFrameTime, WorldSettings->MaxUndilatedFrameTime);
+				Subsystem->AddBucketPrerequisite(TickGroup, PrerequisiteActor.Get());
 			}
 		}
 	}
-
-	TheTimeline.TickTimeline(DeltaTime);
 }
 
-bool UTimelineObject::IsTickable() const
+void UTimelineObject::UpdateTickActivation()
 {
-	return TheTimeline.IsPlaying() && !HasAnyFlags(RF_BeginDestroyed | RF_FinishDestroyed);
+	UTimelineObjectSubsystem* Subsystem = TickSubsystem.Get();
+	if (!Subsystem)
+	{
+		return;
+	}
+
+	if (TheTimeline.IsPlaying())
+	{
+		Subsystem->ActivateTimeline(this);
+	}
+	else
+	{
+		Subsystem->DeactivateTimeline(this);
+	}
 }
 
-bool UTimelineObject::IsTickableInEditor() const
+bool UTimelineObject::UsesLOD() const
 {
-	return false;
+	return LODSettings.bEnableLOD || SignificanceCallback.IsBound() || SignificanceFunction.IsBound();
 }
 
-bool UTimelineObject::IsTickableWhenPaused() const
+void UTimelineObject::ResetLODIfUnused()
 {
-	return false;
+	if (UsesLOD())
+	{
+		return;
+	}
+
+	// Time held back while suspended or throttled is applied by the next update, like any LOD raise
+	if (CurrentLOD != ETimelineObjectLOD::Full)
+	{
+		CurrentLOD = ETimelineObjectLOD::Full;
+		TimeUntilNextUpdate = 0.f;
+	}
+	TimeUntilLODUpdate = 0.f;
 }
 
-TStatId UTimelineObject::GetStatId() const
+bool UTimelineObject::WouldFinishWithin(float DeltaTime) const
 {
-	RETURN_QUICK_DECLARE_CYCLE_STAT(UTimelineObject, STATGROUP_Tickables);
+	if (TheTimeline.IsLooping())
+	{
+		return false;
+	}
+
+	const float Remaining = IsReversing() ? GetPlaybackPosition() : GetTimelineLength() - GetPlaybackPosition();
+	return DeltaTime * FMath::Abs(GetPlayRate()) >= Remaining;
 }
 
-UWorld* UTimelineObject::GetTickableGameObjectWorld() const
+void UTimelineObject::UnregisterFromTickSubsystem()
 {
-	// Prefer cached world for reliable ticking with non-Actor owners
-	if (CachedWorld.IsValid())
+	if (UTimelineObjectSubsystem* Subsystem = TickSubsystem.Get())
 	{
-		return CachedWorld.Get();
+		for (const TWeakObjectPtr<AActor>& PrerequisiteActor : TickPrerequisiteActors)
+		{
+			Subsystem->RemoveBucketPrerequisite(TickGroup, PrerequisiteActor);
+		}
+		Subsystem->UnregisterTimeline(this);
 	}
-	return GetWorld();
+	TickSubsystem.Reset();
 }
 
 #pragma endregion
@@ -699,6 +1725,12 @@ UWorld* UTimelineObject::GetWorld() const
 	return nullptr;
 }
 
+void UTimelineObject::PostInitProperties()
+{
+	Super::PostInitProperties();
+	RegisterWithTickSubsystem();
+}
+
 void UTimelineObject::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
@@ -741,16 +1773,36 @@ bool UTimelineObject::CallRemoteFunction(UFunction* Function, void* Parms, FOutP
 void UTimelineObject::BeginDestroy()
 {
 	Stop();
+	UnregisterFromTickSubsystem();
 	Super::BeginDestroy();
 }
 
 void UTimelineObject::OnRep_Timeline(FTimeline& OldTimeline)
 {
-	// Sync playback position on clients when not actively playing
-	if (!TheTimeline.IsPlaying() && OldTimeline.GetPlaybackPosition() != TheTimeline.GetPlaybackPosition())
+	const float ReplicatedPosition = TheTimeline.GetPlaybackPosition();
+	if (OldTimeline.GetPlaybackPosition() != ReplicatedPosition)
 	{
-		TheTimeline.SetPlaybackPosition(TheTimeline.GetPlaybackPosition(), false, true);
+		// A replicated correction is a seek, not playback: same path as SetPlaybackPosition without events
+		bPendingValuesEvaluated = false;
+		DispatchPendingCallbacks();
+		ResetKeyCursors();
+		bEventHorizonValid = false;
+
+		// Sync playback position on clients when not actively playing
+		if (!TheTimeline.IsPlaying())
+		{
+			TGuardValue<bool> SeekGuard(bSeekingPlayback, true);
+			TGuardValue<bool> SeekEventsGuard(bSeekFiresEvents, false);
+			TheTimeline.SetPlaybackPosition(ReplicatedPosition, false, true);
+		}
+
+		// Key crossings are measured from the replicated position, a backward correction is not a loop wrap
+		LastEventPosition = ReplicatedPosition;
+		bHasEventBaseline = true;
 	}
+
+	// Replicated play state decides whether clients advance this timeline locally
+	UpdateTickActivation();
 }
 
 #pragma endregion
@@ -758,110 +1810,464 @@ void UTimelineObject::OnRep_Timeline(FTimeline& OldTimeline)
 #pragma region Internal Callbacks
 
 void UTimelineObject::Internal_OnTimelineUpdate()
+{
+	const float Position = GetPlaybackPosition();
+	if (bDeferUpdateDispatch)
+	{
+		// Queued for the tick manager's dispatch phase, every update of the frame in playback order
+		PendingUpdatePositions.Add(Position);
+		bPendingValuesEvaluated = false;
+		return;
+	}
+
+	// Updates still queued go out first, so listeners see positions in order
+	DispatchPendingCallbacks();
+
+	EvaluateTracks(Position);
+	DispatchUpdate(Position);
+}
+
+void UTimelineObject::Internal_OnTimelineFinished()
+{
+	if (bDeferUpdateDispatch)
+	{
+		bFinishPending = true;
+		return;
+	}
+
+	DispatchPendingCallbacks();
+	DispatchFinished();
+}
+
+void UTimelineObject::EvaluateTracks(float Position)
+{
+	// Baked tables and fused grids fall back to the curve outside their range
+	float BakedValues[4];
+	alignas(16) float FusedValues[4];
+
+	// Tracks nothing reads keep their stale value until a listener, pin or getter asks for them.
+	// A getter read keeps a track evaluated for one more update only, so tracks read once do not stay hot.
+	using TimelineObjectSubscriptions::IsObserved;
+	const bool bSkipUnobserved = CVarTimelineObjectSkipUnobservedTracks.GetValueOnAnyThread() != 0;
+	const bool bFloatBroadcast = !bSkipUnobserved || OnFloatTrack.IsBound() || OnFloatTrackNativeDelegate.IsBound();
+	const bool bVectorBroadcast = !bSkipUnobserved || OnVectorTrack.IsBound() || OnVectorTrackNativeDelegate.IsBound();
+	const bool bLinearColorBroadcast = !bSkipUnobserved || OnLinearColorTrack.IsBound() || OnLinearColorTrackNativeDelegate.IsBound();
+	int32 NumSkipped = 0;
+
+	for (FTimelineObjectFloatTrack& Track : FloatTracks)
+	{
+		Track.bSkipped = Track.Curve && Track.Shape != ETimelineObjectCurveShape::Constant && !bFloatBroadcast && !IsObserved(Track);
+		Track.bReadByGetter = false;
+		NumSkipped += Track.bSkipped;
+		if (Track.Curve && Track.Shape != ETimelineObjectCurveShape::Constant && !Track.bSkipped)
+		{
+			if (Track.BakedCurve && Track.BakedCurve->Eval(Position, BakedValues))
+			{
+				Track.Value = BakedValues[0];
+			}
+			else
+			{
+				Track.Value = TimelineObjectKeyCursor::EvalShape(Track.Curve->FloatCurve, Track.Shape, Position, Track.KeyCursor);
+			}
+		}
+	}
+
+	for (FTimelineObjectVectorTrack& Track : VectorTracks)
+	{
+		Track.bSkipped = Track.Curve && !Track.bConstant && !bVectorBroadcast && !IsObserved(Track);
+		Track.bReadByGetter = false;
+		NumSkipped += Track.bSkipped;
+		if (Track.Curve && !Track.bConstant && !Track.bSkipped)
+		{
+			if (Track.BakedCurve && Track.BakedCurve->Eval(Position, BakedValues))
+			{
+				Track.Value = FVector(BakedValues[0], BakedValues[1], BakedValues[2]);
+			}
+			else if (Track.FusedCurve && Track.FusedCurve->Eval(Position, Track.FusedCursor, FusedValues))
+			{
+				Track.Value = FVector(FusedValues[0], FusedValues[1], FusedValues[2]);
+			}
+			else
+			{
+				const FRichCurve* Channels = Track.Curve->FloatCurves;
+				Track.Value = FVector(
+					TimelineObjectKeyCursor::EvalShape(Channels[0], Track.Shapes[0], Position, Track.KeyCursors[0]),
+					TimelineObjectKeyCursor::EvalShape(Channels[1], Track.Shapes[1], Position, Track.KeyCursors[1]),
+					TimelineObjectKeyCursor::EvalShape(Channels[2], Track.Shapes[2], Position, Track.KeyCursors[2]));
+			}
+		}
+	}
+
+	for (FTimelineObjectLinearColorTrack& Track : LinearColorTracks)
+	{
+		Track.bSkipped = Track.Curve && !Track.bConstant && !bLinearColorBroadcast && !IsObserved(Track);
+		Track.bReadByGetter = false;
+		NumSkipped += Track.bSkipped;
+		if (Track.Curve && !Track.bConstant && !Track.bSkipped)
+		{
+			if (Track.BakedCurve && Track.BakedCurve->Eval(Position, BakedValues))
+			{
+				Track.Value = FLinearColor(BakedValues[0], BakedValues[1], BakedValues[2], BakedValues[3]);
+			}
+			else if (Track.FusedCurve && Track.FusedCurve->Eval(Position, Track.FusedCursor, FusedValues))
+			{
+				Track.Value = FLinearColor(FusedValues[0], FusedValues[1], FusedValues[2], FusedValues[3]);
+			}
+			else
+			{
+				// The asset applies its HSV adjustments on top of the channels, so it evaluates the keys itself
+				Track.Value = Track.Curve->GetLinearColorValue(Position);
+			}
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_TimelineObjectTrackEvaluationsSkipped, NumSkipped);
+
+	TrackValuesPosition = Position;
+	bTrackValuesValid = true;
+}
+
+void UTimelineObject::ResetKeyCursors()
+{
+	for (FTimelineObjectFloatTrack& Track : FloatTracks)
+	{
+		Track.KeyCursor = TimelineObjectKeyCursor::Invalid;
+	}
+	for (FTimelineObjectVectorTrack& Track : VectorTracks)
+	{
+		Track.KeyCursors[0] = Track.KeyCursors[1] = Track.KeyCursors[2] = TimelineObjectKeyCursor::Invalid;
+		Track.FusedCursor = TimelineObjectKeyCursor::Invalid;
+	}
+	for (FTimelineObjectLinearColorTrack& Track : LinearColorTracks)
+	{
+		Track.FusedCursor = TimelineObjectKeyCursor::Invalid;
+	}
+}
+
+void UTimelineObject::DispatchUpdate(float Position)
+{
+	// Track values go to native listeners first, then through ProcessEvent to dynamic ones; unbound delegates cost one check.
+	// Within each phase, per-track subscribers run before the name-filtered global delegates.
+	const bool bHasTrackSubscriptions = TrackSubscriptions.Num() > 0;
+	if (bHasTrackSubscriptions || OnFloatTrackNativeDelegate.IsBound() || OnVectorTrackNativeDelegate.IsBound() || OnLinearColorTrackNativeDelegate.IsBound())
+	{
+		SCOPE_CYCLE_COUNTER(STAT_TimelineObjectNativeDispatch);
+		if (bHasTrackSubscriptions)
+		{
+			BroadcastTrackSubscribers(true);
+		}
+		BroadcastTrackValues(OnFloatTrackNativeDelegate, OnVectorTrackNativeDelegate, OnLinearColorTrackNativeDelegate);
+	}
+	if (bHasTrackSubscriptions || OnFloatTrack.IsBound() || OnVectorTrack.IsBound() || OnLinearColorTrack.IsBound())
+	{
+		SCOPE_CYCLE_COUNTER(STAT_TimelineObjectDynamicDispatch);
+		if (bHasTrackSubscriptions)
+		{
+			BroadcastTrackSubscribers(false);
+		}
+		BroadcastTrackValues(OnFloatTrack, OnVectorTrack, OnLinearColorTrack);
+	}
+
+	// Fire event track keys and added events crossed by this update
+	CheckEventTracks(Position);
+
+	// Fire the general update delegate
+	if (OnTimelineUpdateNative.IsBound())
+	{
+		SCOPE_CYCLE_COUNTER(STAT_TimelineObjectNativeDispatch);
+		OnTimelineUpdateNative.Broadcast();
+	}
+	if (OnTimelineUpdate.IsBound() || UserPostUpdateFunc.IsBound())
+	{
+		SCOPE_CYCLE_COUNTER(STAT_TimelineObjectDynamicDispatch);
+		OnTimelineUpdate.Broadcast();
+		UserPostUpdateFunc.ExecuteIfBound();
+	}
+}
+
+template <typename FloatDelegateType, typename VectorDelegateType, typename LinearColorDelegateType>
+void UTimelineObject::BroadcastTrackValues(FloatDelegateType& FloatDelegate, VectorDelegateType& VectorDelegate, LinearColorDelegateType& LinearColorDelegate) const
 {
 	// Broadcast float track values
-	for (const auto& Pair : FloatTrackCurves)
+	if (FloatDelegate.IsBound())
 	{
-		if (Pair.Value)
+		for (const FTimelineObjectFloatTrack& Track : FloatTracks)
 		{
-			float Value = Pair.Value->GetFloatValue(GetPlaybackPosition());
-			OnFloatTrack.Broadcast(Pair.Key, Value);
+			if (Track.Curve && !Track.bSkipped)
+			{
+				FloatDelegate.Broadcast(Track.TrackName, Track.Value);
+			}
 		}
 	}
 
 	// Broadcast vector track values
-	for (const auto& Pair : VectorTrackCurves)
+	if (VectorDelegate.IsBound())
 	{
-		if (Pair.Value)
+		for (const FTimelineObjectVectorTrack& Track : VectorTracks)
 		{
-			FVector Value = Pair.Value->GetVectorValue(GetPlaybackPosition());
-			OnVectorTrack.Broadcast(Pair.Key, Value);
+			if (Track.Curve && !Track.bSkipped)
+			{
+				VectorDelegate.Broadcast(Track.TrackName, Track.Value);
+			}
 		}
 	}
 
 	// Broadcast linear color track values
-	for (const auto& Pair : LinearColorTrackCurves)
+	if (LinearColorDelegate.IsBound())
 	{
-		if (Pair.Value)
+		for (const FTimelineObjectLinearColorTrack& Track : LinearColorTracks)
 		{
-			FLinearColor Value = Pair.Value->GetLinearColorValue(GetPlaybackPosition());
-			OnLinearColorTrack.Broadcast(Pair.Key, Value);
+			if (Track.Curve && !Track.bSkipped)
+			{
+				LinearColorDelegate.Broadcast(Track.TrackName, Track.Value);
+			}
 		}
 	}
+}
 
-	// Check and fire event tracks
-	CheckEventTracks();
+void UTimelineObject::DispatchFinished()
+{
+	OnTimelineFinishedNative.Broadcast();
+	OnTimelineFinished.Broadcast();
+	UserFinishedFunc.ExecuteIfBound();
+	UserFinishedFuncStatic.ExecuteIfBound();
 
-	// Fire the general update delegate
-	OnTimelineUpdate.Broadcast();
+	// Handlers may restart playback, so sync the active set after broadcasting
+	UpdateTickActivation();
 }
 
-void UTimelineObject::Internal_OnTimelineFinished()
+void UTimelineObject::DispatchPendingCallbacks()
 {
-	OnTimelineFinished.Broadcast();
+	if (PendingUpdatePositions.Num() == 0 && !bFinishPending)
+	{
+		return;
+	}
+
+	// Callbacks fired from here run immediately, even if they touch this timeline again
+	TGuardValue<bool> ImmediateDispatchGuard(bDeferUpdateDispatch, false);
+
+	// Taken out first, so a handler that seeks this timeline does not dispatch them a second time
+	const TArray<float, TInlineAllocator<2>> Positions = MoveTemp(PendingUpdatePositions);
+	PendingUpdatePositions.Reset();
+	const bool bValuesEvaluated = bPendingValuesEvaluated && Positions.Num() == 1;
+	const bool bFinished = bFinishPending;
+	bPendingValuesEvaluated = false;
+	bFinishPending = false;
+
+	for (const float Position : Positions)
+	{
+		if (!bValuesEvaluated)
+		{
+			EvaluateTracks(Position);
+		}
+		DispatchUpdate(Position);
+	}
+
+	if (bFinished)
+	{
+		DispatchFinished();
+	}
 }
 
-void UTimelineObject::CheckEventTracks()
+void UTimelineObject::CheckEventTracks(float CurrentPosition)
 {
-	const float CurrentPosition = GetPlaybackPosition();
-	const bool bIsReversing = IsReversing();
+	const float LastPosition = LastEventPosition;
+	const bool bHadBaseline = bHasEventBaseline;
+	LastEventPosition = CurrentPosition;
+	bHasEventBaseline = true;
 
-	for (auto& Pair : EventTrackCurves)
+	if (!bHadBaseline || EventSchedule.Num() == 0 || CurrentPosition == LastPosition)
 	{
-		UCurveFloat* EventCurve = Pair.Value;
-		if (!EventCurve)
+		return;
+	}
+
+	// Between events there is nothing to search for: playback moved forward (or backward when reversing)
+	// without reaching the next event. Anything else, loop wraps included, takes the full check.
+	const bool bReversing = IsReversing();
+	if (bEventHorizonValid && bEventHorizonReversed == bReversing && !bSeekingPlayback)
+	{
+		const bool bBeforeHorizon = bReversing
+			? (CurrentPosition < LastPosition && CurrentPosition > NextEventTime)
+			: (CurrentPosition > LastPosition && CurrentPosition < NextEventTime);
+		if (bBeforeHorizon)
 		{
-			continue;
+			INC_DWORD_STAT(STAT_TimelineObjectEventChecksSkipped);
+			return;
 		}
+	}
 
-		const FName& TrackName = Pair.Key;
-		float* LastPositionPtr = LastEventTrackPositions.Find(TrackName);
-		if (!LastPositionPtr)
+	// Measured before any handler runs, handlers that seek, turn around or add events invalidate it again
+	UpdateEventHorizon();
+
+	TArray<FTimelineObjectScheduledEvent, TInlineAllocator<8>> CrossedEvents;
+
+	// Seeks fire only when asked to, every event of the jumped range in the order of the jump
+	if (bSeekingPlayback)
+	{
+		if (!bSeekFiresEvents)
 		{
-			LastEventTrackPositions.Add(TrackName, -1.0f);
-			LastPositionPtr = LastEventTrackPositions.Find(TrackName);
+			return;
 		}
 
-		float LastPosition = *LastPositionPtr;
-		*LastPositionPtr = CurrentPosition;
+		if (CurrentPosition > LastPosition)
+		{
+			CollectEventKeys(LastPosition, CurrentPosition, false, true, false, CrossedEvents);
+		}
+		else
+		{
+			CollectEventKeys(CurrentPosition, LastPosition, true, false, true, CrossedEvents);
+		}
 
-		// Skip first frame to establish baseline position
-		if (LastPosition < 0.0f)
+		if (SeekEventMode == ETimelineObjectSeekEvents::Coalesce)
 		{
-			continue;
+			if (CrossedEvents.Num() > 0)
+			{
+				OnEventsSkipped.Broadcast(CrossedEvents.Num());
+			}
+		}
+		else
+		{
+			FireScheduledEvents(CrossedEvents);
 		}
+		return;
+	}
 
-		const FRichCurve& Curve = EventCurve->FloatCurve;
-		
-		// Check each key to see if we crossed it this frame
-		for (auto It = Curve.GetKeyIterator(); It; ++It)
+	// Events are fired from (last, current] in the playback direction. Moving against the direction
+	// is a loop wrap: the lap is finished to its end, then the next lap starts including its first key.
+	const float Length = GetTimelineLength();
+	if (!bReversing)
+	{
+		if (CurrentPosition > LastPosition)
 		{
-			const float KeyTime = It->Time;
-			
-			bool bShouldFire;
-			if (bIsReversing)
+			CollectEventKeys(LastPosition, CurrentPosition, false, true, false, CrossedEvents);
+		}
+		else
+		{
+			CollectEventKeys(LastPosition, Length, false, true, false, CrossedEvents);
+			CollectEventKeys(0.f, CurrentPosition, true, true, false, CrossedEvents);
+		}
+	}
+	else
+	{
+		if (CurrentPosition < LastPosition)
+		{
+			CollectEventKeys(CurrentPosition, LastPosition, true, false, true, CrossedEvents);
+		}
+		else
+		{
+			CollectEventKeys(0.f, LastPosition, true, false, true, CrossedEvents);
+			CollectEventKeys(CurrentPosition, Length, true, true, true, CrossedEvents);
+		}
+	}
+
+	FireScheduledEvents(CrossedEvents);
+}
+
+void UTimelineObject::FireScheduledEvents(TConstArrayView<FTimelineObjectScheduledEvent> Events)
+{
+	// Entries are copies, handlers may add events or tracks while they run
+	for (const FTimelineObjectScheduledEvent& Event : Events)
+	{
+		if (EventTracks.IsValidIndex(Event.TrackIndex))
+		{
+			const FName TrackName = EventTracks[Event.TrackIndex].TrackName;
+			if (FOnTimelineObjectEventNative* NativeDelegate = EventTrackNativeDelegates.Find(TrackName))
 			{
-				// Playing backwards: fire if key is between current (lower) and last (higher) position
-				bShouldFire = (KeyTime < LastPosition && KeyTime >= CurrentPosition);
+				SCOPE_CYCLE_COUNTER(STAT_TimelineObjectNativeDispatch);
+				NativeDelegate->Broadcast();
 			}
-			else
+			if (FOnTimelineObjectEvent* TrackDelegate = EventTrackDelegates.Find(TrackName))
 			{
-				// Playing forwards: fire if key is between last (lower) and current (higher) position
-				bShouldFire = (KeyTime > LastPosition && KeyTime <= CurrentPosition);
+				SCOPE_CYCLE_COUNTER(STAT_TimelineObjectDynamicDispatch);
+				TrackDelegate->Broadcast();
 			}
+		}
+		else if (AddedEvents.IsValidIndex(Event.AddedEventIndex))
+		{
+			AddedEvents[Event.AddedEventIndex].Value.ExecuteIfBound();
+		}
+	}
+}
+
+void UTimelineObject::CollectEventKeys(float RangeStart, float RangeEnd, bool bIncludeStart, bool bIncludeEnd, bool bDescending, TArray<FTimelineObjectScheduledEvent, TInlineAllocator<8>>& OutEvents) const
+{
+	if (RangeEnd < RangeStart)
+	{
+		return;
+	}
+
+	const int32 First = bIncludeStart
+		? Algo::LowerBoundBy(EventSchedule, RangeStart, &FTimelineObjectScheduledEvent::Time)
+		: Algo::UpperBoundBy(EventSchedule, RangeStart, &FTimelineObjectScheduledEvent::Time);
+	const int32 End = bIncludeEnd
+		? Algo::UpperBoundBy(EventSchedule, RangeEnd, &FTimelineObjectScheduledEvent::Time)
+		: Algo::LowerBoundBy(EventSchedule, RangeEnd, &FTimelineObjectScheduledEvent::Time);
+
+	if (!bDescending)
+	{
+		OutEvents.Append(EventSchedule.GetData() + First, FMath::Max(End - First, 0));
+		return;
+	}
+
+	// Walk groups of equal time backwards, each group in schedule order
+	int32 GroupEnd = End;
+	while (GroupEnd > First)
+	{
+		int32 GroupStart = GroupEnd - 1;
+		while (GroupStart > First && EventSchedule[GroupStart - 1].Time == EventSchedule[GroupEnd - 1].Time)
+		{
+			--GroupStart;
+		}
+		OutEvents.Append(EventSchedule.GetData() + GroupStart, GroupEnd - GroupStart);
+		GroupEnd = GroupStart;
+	}
+}
 
-			if (bShouldFire)
+void UTimelineObject::RebuildEventSchedule()
+{
+	EventSchedule.Reset();
+	for (int32 TrackIndex = 0; TrackIndex < EventTracks.Num(); ++TrackIndex)
+	{
+		if (const UCurveFloat* Curve = EventTracks[TrackIndex].Curve)
+		{
+			for (const FRichCurveKey& Key : Curve->FloatCurve.GetConstRefOfKeys())
 			{
-				FOnTimelineObjectEvent* TrackDelegate = EventTrackDelegates.Find(TrackName);
-				if (TrackDelegate)
-				{
-					TrackDelegate->Broadcast();
-				}
-				// Only fire once per frame even if multiple keys were crossed
-				break;
+				EventSchedule.Add({ Key.Time, TrackIndex, INDEX_NONE });
 			}
 		}
 	}
+	for (int32 EventIndex = 0; EventIndex < AddedEvents.Num(); ++EventIndex)
+	{
+		EventSchedule.Add({ AddedEvents[EventIndex].Key, INDEX_NONE, EventIndex });
+	}
+
+	Algo::StableSortBy(EventSchedule, &FTimelineObjectScheduledEvent::Time);
+	bEventHorizonValid = false;
+}
+
+void UTimelineObject::UpdateEventHorizon()
+{
+	bEventHorizonReversed = IsReversing();
+	if (bEventHorizonReversed)
+	{
+		const int32 Previous = Algo::LowerBoundBy(EventSchedule, LastEventPosition, &FTimelineObjectScheduledEvent::Time) - 1;
+		NextEventTime = Previous >= 0 ? EventSchedule[Previous].Time : -MAX_flt;
+	}
+	else
+	{
+		const int32 Next = Algo::UpperBoundBy(EventSchedule, LastEventPosition, &FTimelineObjectScheduledEvent::Time);
+		NextEventTime = Next < EventSchedule.Num() ? EventSchedule[Next].Time : MAX_flt;
+	}
+	bEventHorizonValid = true;
+}
+
+void UTimelineObject::EnsureEventBaseline()
+{
+	if (!bHasEventBaseline)
+	{
+		LastEventPosition = GetPlaybackPosition();
+		bHasEventBaseline = true;
+	}
 }
 
 #pragma endregion
\ No newline at end of file
@@ -0,0 +1,299 @@
+#include "TimelineObjectBakedCurve.h"
+#include "Curves/CurveFloat.h"
+#include "Curves/CurveLinearColor.h"
+#include "Curves/CurveVector.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/ObjectKey.h"
+
+namespace TimelineObjectBakedCurve
+{
+	/** Upper bound on samples per table, so a long curve at a high rate cannot allocate without limit */
+	constexpr int32 MaxSamples = 8192;
+
+	/** Points probed inside every sample interval when measuring the baking error */
+	constexpr int32 ErrorProbesPerInterval = 4;
+
+	struct FCacheEntry
+	{
+		TWeakObjectPtr<const UCurveBase> Curve;
+		TWeakPtr<const FTimelineObjectBakedCurve> Table;
+	};
+
+	using FCacheKey = TPair<TObjectKey<UCurveBase>, float>;
+
+	static TMap<FCacheKey, FCacheEntry>& GetCache()
+	{
+		static TMap<FCacheKey, FCacheEntry> Cache;
+		return Cache;
+	}
+
+	static int32 GetNumChannels(const UCurveBase* Curve)
+	{
+		if (Curve->IsA<UCurveFloat>())
+		{
+			return 1;
+		}
+		if (Curve->IsA<UCurveVector>())
+		{
+			return 3;
+		}
+		if (Curve->IsA<UCurveLinearColor>())
+		{
+			return 4;
+		}
+		return 0;
+	}
+
+	/** Samples the curve through the asset's own evaluator, so color adjustments are baked in */
+	static void SampleCurve(const UCurveBase* Curve, float Time, float* OutValues)
+	{
+		if (const UCurveFloat* FloatCurve = Cast<UCurveFloat>(Curve))
+		{
+			OutValues[0] = FloatCurve->GetFloatValue(Time);
+		}
+		else if (const UCurveVector* VectorCurve = Cast<UCurveVector>(Curve))
+		{
+			const FVector Value = VectorCurve->GetVectorValue(Time);
+			OutValues[0] = static_cast<float>(Value.X);
+			OutValues[1] = static_cast<float>(Value.Y);
+			OutValues[2] = static_cast<float>(Value.Z);
+		}
+		else if (const UCurveLinearColor* ColorCurve = Cast<UCurveLinearColor>(Curve))
+		{
+			const FLinearColor Value = ColorCurve->GetLinearColorValue(Time);
+			OutValues[0] = Value.R;
+			OutValues[1] = Value.G;
+			OutValues[2] = Value.B;
+			OutValues[3] = Value.A;
+		}
+	}
+
+	static bool IsConstantExtrapolation(ERichCurveExtrapolation Extrapolation)
+	{
+		return Extrapolation == RCCE_Constant || Extrapolation == RCCE_None;
+	}
+
+	static TSharedPtr<FTimelineObjectBakedCurve> Bake(const UCurveBase* Curve, float SampleRate, uint32 Signature)
+	{
+		const int32 NumChannels = GetNumChannels(Curve);
+		if (NumChannels == 0)
+		{
+			return nullptr;
+		}
+
+		// Curves with fewer than two keys per channel already evaluate in constant time
+		int32 MaxKeys = 0;
+		bool bClampBeforeStart = true;
+		bool bClampAfterEnd = true;
+		for (const FRichCurveEditInfoConst& CurveInfo : Curve->GetCurves())
+		{
+			if (const FRealCurve* RealCurve = CurveInfo.CurveToEdit)
+			{
+				MaxKeys = FMath::Max(MaxKeys, RealCurve->GetNumKeys());
+				bClampBeforeStart &= IsConstantExtrapolation(RealCurve->PreInfinityExtrap);
+				bClampAfterEnd &= IsConstantExtrapolation(RealCurve->PostInfinityExtrap);
+			}
+		}
+
+		float StartTime = 0.f;
+		float EndTime = 0.f;
+		Curve->GetTimeRange(StartTime, EndTime);
+		if (MaxKeys < 2 || EndTime <= StartTime)
+		{
+			return nullptr;
+		}
+
+		const int32 NumSamples = FMath::Clamp(FMath::CeilToInt32((EndTime - StartTime) * SampleRate) + 1, 2, MaxSamples);
+
+		TSharedPtr<FTimelineObjectBakedCurve> Table = MakeShared<FTimelineObjectBakedCurve>();
+		Table->StartTime = StartTime;
+		Table->EndTime = EndTime;
+		Table->SampleRate = (NumSamples - 1) / (EndTime - StartTime);
+		Table->NumChannels = NumChannels;
+		Table->SourceSignature = Signature;
+		Table->bClampBeforeStart = bClampBeforeStart;
+		Table->bClampAfterEnd = bClampAfterEnd;
+		Table->Samples.SetNumUninitialized(NumSamples * NumChannels);
+
+		for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+		{
+			const float Time = SampleIndex < NumSamples - 1 ? StartTime + SampleIndex / Table->SampleRate : EndTime;
+			SampleCurve(Curve, Time, &Table->Samples[SampleIndex * NumChannels]);
+		}
+
+		// Measure the worst deviation from the source between samples, where interpolation error peaks
+		float Baked[4];
+		float Source[4];
+		float MaxError = 0.f;
+		for (int32 SampleIndex = 0; SampleIndex < NumSamples - 1; ++SampleIndex)
+		{
+			for (int32 Probe = 1; Probe < ErrorProbesPerInterval; ++Probe)
+			{
+				const float Time = StartTime + (SampleIndex + static_cast<float>(Probe) / ErrorProbesPerInterval) / Table->SampleRate;
+				Table->Eval(Time, Baked);
+				SampleCurve(Curve, Time, Source);
+				for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+				{
+					MaxError = FMath::Max(MaxError, FMath::Abs(Baked[Channel] - Source[Channel]));
+				}
+			}
+		}
+		Table->MaxError = MaxError;
+
+		return Table;
+	}
+
+	static FAutoConsoleCommandWithOutputDevice DumpBakedCurvesCommand(
+		TEXT("ObjectTimeline.DumpBakedCurves"),
+		TEXT("Lists every baked timeline curve table with its size and maximum error versus the source curve."),
+		FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&FTimelineObjectBakedCurveCache::DumpToOutputDevice));
+}
+
+bool FTimelineObjectBakedCurve::Eval(float InTime, float* OutValues) const
+{
+	const int32 NumSamples = Samples.Num() / NumChannels;
+
+	int32 SampleIndex = 0;
+	float Alpha = 0.f;
+	if (InTime <= StartTime)
+	{
+		if (InTime < StartTime && !bClampBeforeStart)
+		{
+			return false;
+		}
+	}
+	else if (InTime >= EndTime)
+	{
+		if (InTime > EndTime && !bClampAfterEnd)
+		{
+			return false;
+		}
+		SampleIndex = NumSamples - 1;
+	}
+	else
+	{
+		const float SamplePosition = (InTime - StartTime) * SampleRate;
+		SampleIndex = FMath::Min(FMath::FloorToInt32(SamplePosition), NumSamples - 2);
+		Alpha = SamplePosition - SampleIndex;
+	}
+
+	const float* Sample = &Samples[SampleIndex * NumChannels];
+	if (Alpha > 0.f)
+	{
+		const float* NextSample = Sample + NumChannels;
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			OutValues[Channel] = FMath::Lerp(Sample[Channel], NextSample[Channel], Alpha);
+		}
+	}
+	else
+	{
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			OutValues[Channel] = Sample[Channel];
+		}
+	}
+	return true;
+}
+
+TSharedPtr<const FTimelineObjectBakedCurve> FTimelineObjectBakedCurveCache::FindOrBake(const UCurveBase* Curve, float SampleRate)
+{
+	check(IsInGameThread());
+
+	if (!Curve || SampleRate <= 0.f)
+	{
+		return nullptr;
+	}
+
+	using namespace TimelineObjectBakedCurve;
+	TMap<FCacheKey, FCacheEntry>& Cache = GetCache();
+
+	// Drop tables no track references anymore
+	for (auto It = Cache.CreateIterator(); It; ++It)
+	{
+		if (!It->Value.Table.IsValid() || !It->Value.Curve.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	const uint32 Signature = ComputeSourceSignature(Curve);
+	FCacheEntry& Entry = Cache.FindOrAdd(FCacheKey(Curve, SampleRate));
+	if (TSharedPtr<const FTimelineObjectBakedCurve> Existing = Entry.Table.Pin())
+	{
+		if (Existing->SourceSignature == Signature)
+		{
+			return Existing;
+		}
+	}
+
+	TSharedPtr<const FTimelineObjectBakedCurve> Table = Bake(Curve, SampleRate, Signature);
+	Entry.Curve = Curve;
+	Entry.Table = Table;
+	return Table;
+}
+
+void FTimelineObjectBakedCurveCache::DumpToOutputDevice(FOutputDevice& Ar)
+{
+	using namespace TimelineObjectBakedCurve;
+
+	SIZE_T TotalBytes = 0;
+	int32 NumTables = 0;
+	for (const TPair<FCacheKey, FCacheEntry>& Pair : GetCache())
+	{
+		TSharedPtr<const FTimelineObjectBakedCurve> Table = Pair.Value.Table.Pin();
+		const UCurveBase* Curve = Pair.Value.Curve.Get();
+		if (!Table || !Curve)
+		{
+			continue;
+		}
+
+		Ar.Logf(TEXT("%s @ %.1f Hz: %d samples x %d channels, %llu bytes, max error %g, references %d"),
+			*Curve->GetPathName(), Pair.Key.Value, Table->Samples.Num() / Table->NumChannels, Table->NumChannels,
+			static_cast<uint64>(Table->GetAllocatedSize()), Table->MaxError, Table.GetSharedReferenceCount() - 1);
+		TotalBytes += Table->GetAllocatedSize();
+		++NumTables;
+	}
+	Ar.Logf(TEXT("%d baked curve tables, %llu bytes"), NumTables, static_cast<uint64>(TotalBytes));
+}
+
+uint32 FTimelineObjectBakedCurveCache::ComputeSourceSignature(const UCurveBase* Curve)
+{
+	uint32 Signature = 0;
+	for (const FRichCurveEditInfoConst& CurveInfo : Curve->GetCurves())
+	{
+		const FRichCurve* RichCurve = static_cast<const FRichCurve*>(CurveInfo.CurveToEdit);
+		if (!RichCurve)
+		{
+			continue;
+		}
+
+		Signature = HashCombineFast(Signature, GetTypeHash(RichCurve->PreInfinityExtrap.GetValue()));
+		Signature = HashCombineFast(Signature, GetTypeHash(RichCurve->PostInfinityExtrap.GetValue()));
+		Signature = HashCombineFast(Signature, GetTypeHash(RichCurve->DefaultValue));
+		for (const FRichCurveKey& Key : RichCurve->GetConstRefOfKeys())
+		{
+			Signature = HashCombineFast(Signature, GetTypeHash(Key.Time));
+			Signature = HashCombineFast(Signature, GetTypeHash(Key.Value));
+			Signature = HashCombineFast(Signature, GetTypeHash(Key.ArriveTangent));
+			Signature = HashCombineFast(Signature, GetTypeHash(Key.LeaveTangent));
+			Signature = HashCombineFast(Signature, GetTypeHash(static_cast<uint8>(Key.InterpMode)));
+			Signature = HashCombineFast(Signature, GetTypeHash(static_cast<uint8>(Key.TangentWeightMode)));
+			Signature = HashCombineFast(Signature, GetTypeHash(Key.ArriveTangentWeight));
+			Signature = HashCombineFast(Signature, GetTypeHash(Key.LeaveTangentWeight));
+		}
+	}
+
+	// Color tables bake the asset's adjustments in, so editing them must invalidate the table too
+	if (const UCurveLinearColor* ColorCurve = Cast<UCurveLinearColor>(Curve))
+	{
+		Signature = HashCombineFast(Signature, GetTypeHash(ColorCurve->AdjustHue));
+		Signature = HashCombineFast(Signature, GetTypeHash(ColorCurve->AdjustSaturation));
+		Signature = HashCombineFast(Signature, GetTypeHash(ColorCurve->AdjustBrightness));
+		Signature = HashCombineFast(Signature, GetTypeHash(ColorCurve->AdjustBrightnessCurve));
+		Signature = HashCombineFast(Signature, GetTypeHash(ColorCurve->AdjustVibrance));
+		Signature = HashCombineFast(Signature, GetTypeHash(ColorCurve->AdjustMinAlpha));
+		Signature = HashCombineFast(Signature, GetTypeHash(ColorCurve->AdjustMaxAlpha));
+	}
+	return Signature;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UCurveBase;
+
+/**
+ * Curve asset sampled at a uniform rate, evaluated with one index computation and a lerp.
+ * Immutable once baked and shared by every track referencing the same curve at the same sample rate.
+ */
+struct FTimelineObjectBakedCurve
+{
+	/** Time of the first sample */
+	float StartTime = 0.f;
+
+	/** Time of the last sample */
+	float EndTime = 0.f;
+
+	/** Effective samples per second, slightly above the requested rate so samples land on both ends */
+	float SampleRate = 0.f;
+
+	/** Number of channels per sample: 1 for float, 3 for vector, 4 for linear color curves */
+	int32 NumChannels = 0;
+
+	/** Sample values, NumChannels floats per sample */
+	TArray<float> Samples;
+
+	/** Largest absolute difference to the source curve measured between samples, across all channels */
+	float MaxError = 0.f;
+
+	/** Hash of the source keys the table was baked from */
+	uint32 SourceSignature = 0;
+
+	/** Whether evaluation before StartTime or after EndTime can clamp to the end samples */
+	bool bClampBeforeStart = false;
+	bool bClampAfterEnd = false;
+
+	/**
+	 * Writes NumChannels values at InTime to OutValues.
+	 * @return false when InTime lies outside the table and the source curve extrapolates non-constantly
+	 */
+	bool Eval(float InTime, float* OutValues) const;
+
+	/** Bytes used by the sample table */
+	SIZE_T GetAllocatedSize() const { return Samples.GetAllocatedSize(); }
+};
+
+/**
+ * Process-wide cache of baked curves, keyed by curve asset and sample rate.
+ * Tables are shared by reference and released once no track uses them.
+ */
+class FTimelineObjectBakedCurveCache
+{
+public:
+
+	/**
+	 * Returns the baked table of the curve at the sample rate, baking it on first use.
+	 * Returns null for curves that do not benefit from baking (fewer than two keys). Game thread only.
+	 */
+	static TSharedPtr<const FTimelineObjectBakedCurve> FindOrBake(const UCurveBase* Curve, float SampleRate);
+
+	/** Prints every live table with its size and measured error */
+	static void DumpToOutputDevice(FOutputDevice& Ar);
+
+	/** Hashes every key and extrapolation mode of the curve, so derived data can detect edited assets */
+	static uint32 ComputeSourceSignature(const UCurveBase* Curve);
+};
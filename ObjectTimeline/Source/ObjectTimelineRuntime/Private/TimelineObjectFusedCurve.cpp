@@ -0,0 +1,343 @@
+#include "TimelineObjectFusedCurve.h"
+#include "TimelineObjectBakedCurve.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Unique.h"
+#include "Curves/CurveLinearColor.h"
+#include "Curves/CurveVector.h"
+#include "UObject/ObjectKey.h"
+
+namespace TimelineObjectFusedCurve
+{
+	/** Segments walked from the cursor before giving up and searching */
+	constexpr int32 MaxWalkSteps = 4;
+
+	struct FCacheEntry
+	{
+		TWeakObjectPtr<const UCurveBase> Curve;
+		TWeakPtr<const FTimelineObjectFusedCurve> Fused;
+
+		/** Signature of a curve found unsupported, so it is not rebuilt for every track */
+		TOptional<uint32> UnsupportedSignature;
+	};
+
+	static TMap<TObjectKey<UCurveBase>, FCacheEntry>& GetCache()
+	{
+		static TMap<TObjectKey<UCurveBase>, FCacheEntry> Cache;
+		return Cache;
+	}
+
+	static bool IsConstantExtrapolation(ERichCurveExtrapolation Extrapolation)
+	{
+		return Extrapolation == RCCE_Constant || Extrapolation == RCCE_None;
+	}
+
+	static void FillConstant(double Value, double OutPoints[4])
+	{
+		OutPoints[0] = OutPoints[1] = OutPoints[2] = OutPoints[3] = Value;
+	}
+
+	/** Restricts the cubic Bezier Q over [0, 1] to [U0, U1] with two de Casteljau splits */
+	static void SplitBezier(const double Q[4], double U0, double U1, double OutPoints[4])
+	{
+		auto Lerp = [](double A, double B, double T) { return A + (B - A) * T; };
+
+		// Right part after U0
+		const double Q01 = Lerp(Q[0], Q[1], U0);
+		const double Q12 = Lerp(Q[1], Q[2], U0);
+		const double Q23 = Lerp(Q[2], Q[3], U0);
+		const double Q012 = Lerp(Q01, Q12, U0);
+		const double Q123 = Lerp(Q12, Q23, U0);
+		const double R[4] = { Lerp(Q012, Q123, U0), Q123, Q23, Q[3] };
+
+		// Left part of that up to U1, remapped into the right part's parameter
+		const double V = U0 < 1.0 ? (U1 - U0) / (1.0 - U0) : 1.0;
+		const double R01 = Lerp(R[0], R[1], V);
+		const double R12 = Lerp(R[1], R[2], V);
+		const double R23 = Lerp(R[2], R[3], V);
+		const double R012 = Lerp(R01, R12, V);
+		const double R123 = Lerp(R12, R23, V);
+		OutPoints[0] = R[0];
+		OutPoints[1] = R01;
+		OutPoints[2] = R012;
+		OutPoints[3] = Lerp(R012, R123, V);
+	}
+
+	/**
+	 * Computes the Bezier control points of one channel over the grid segment [Ta, Tb].
+	 * @return false when the channel cannot be represented on this segment
+	 */
+	static bool BuildChannelSegment(const FRichCurve& Curve, float EmptyValue, double Ta, double Tb, double OutPoints[4])
+	{
+		const TArray<FRichCurveKey>& Keys = Curve.GetConstRefOfKeys();
+		const int32 NumKeys = Keys.Num();
+		if (NumKeys == 0)
+		{
+			FillConstant(EmptyValue, OutPoints);
+			return true;
+		}
+		if (NumKeys == 1)
+		{
+			FillConstant(Keys[0].Value, OutPoints);
+			return true;
+		}
+
+		// Outside its own keys but inside the grid, a channel is only representable while it holds still
+		if (Tb <= Keys[0].Time)
+		{
+			FillConstant(Keys[0].Value, OutPoints);
+			return IsConstantExtrapolation(Curve.PreInfinityExtrap);
+		}
+		if (Ta >= Keys[NumKeys - 1].Time)
+		{
+			FillConstant(Keys[NumKeys - 1].Value, OutPoints);
+			return IsConstantExtrapolation(Curve.PostInfinityExtrap);
+		}
+
+		// Grid points include every key, so the segment lies within one source segment
+		int32 KeyIndex = 0;
+		while (KeyIndex < NumKeys - 2 && Keys[KeyIndex + 1].Time <= Ta)
+		{
+			++KeyIndex;
+		}
+
+		const FRichCurveKey& Key1 = Keys[KeyIndex];
+		const FRichCurveKey& Key2 = Keys[KeyIndex + 1];
+		const double Diff = static_cast<double>(Key2.Time) - Key1.Time;
+		if (Diff <= 0.0 || Key1.InterpMode == RCIM_Constant)
+		{
+			FillConstant(Key1.Value, OutPoints);
+			return true;
+		}
+
+		const double U0 = (Ta - Key1.Time) / Diff;
+		const double U1 = (Tb - Key1.Time) / Diff;
+		if (Key1.InterpMode == RCIM_Linear)
+		{
+			// A line is a Bezier with evenly spaced control points
+			const double V0 = Key1.Value + (static_cast<double>(Key2.Value) - Key1.Value) * U0;
+			const double V1 = Key1.Value + (static_cast<double>(Key2.Value) - Key1.Value) * U1;
+			OutPoints[0] = V0;
+			OutPoints[1] = V0 + (V1 - V0) / 3.0;
+			OutPoints[2] = V0 + (V1 - V0) * 2.0 / 3.0;
+			OutPoints[3] = V1;
+			return true;
+		}
+
+		const bool bUnweighted = (Key1.TangentWeightMode == RCTWM_WeightedNone || Key1.TangentWeightMode == RCTWM_WeightedArrive)
+			&& (Key2.TangentWeightMode == RCTWM_WeightedNone || Key2.TangentWeightMode == RCTWM_WeightedLeave);
+		if (!bUnweighted)
+		{
+			return false;
+		}
+
+		const double Q[4] = {
+			Key1.Value,
+			Key1.Value + Key1.LeaveTangent * Diff / 3.0,
+			Key2.Value - Key2.ArriveTangent * Diff / 3.0,
+			Key2.Value
+		};
+		SplitBezier(Q, U0, U1, OutPoints);
+		return true;
+	}
+
+	static TSharedPtr<FTimelineObjectFusedCurve> Build(const FRichCurve* Channels, const float* EmptyValues, int32 NumChannels, uint32 Signature)
+	{
+		TArray<float> GridTimes;
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			for (const FRichCurveKey& Key : Channels[Channel].GetConstRefOfKeys())
+			{
+				GridTimes.Add(Key.Time);
+			}
+		}
+		GridTimes.Sort();
+		GridTimes.SetNum(Algo::Unique(GridTimes));
+		if (GridTimes.Num() < 2)
+		{
+			return nullptr;
+		}
+
+		TSharedPtr<FTimelineObjectFusedCurve> Fused = MakeShared<FTimelineObjectFusedCurve>();
+		Fused->NumChannels = NumChannels;
+		Fused->SourceSignature = Signature;
+		Fused->ControlPoints.Reserve((GridTimes.Num() - 1) * 4);
+
+		for (int32 Segment = 0; Segment < GridTimes.Num() - 1; ++Segment)
+		{
+			float Lanes[4][4] = {};
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				double Points[4];
+				if (!BuildChannelSegment(Channels[Channel], EmptyValues[Channel], GridTimes[Segment], GridTimes[Segment + 1], Points))
+				{
+					return nullptr;
+				}
+				for (int32 Point = 0; Point < 4; ++Point)
+				{
+					Lanes[Point][Channel] = static_cast<float>(Points[Point]);
+				}
+			}
+			for (int32 Point = 0; Point < 4; ++Point)
+			{
+				Fused->ControlPoints.Add(VectorLoad(Lanes[Point]));
+			}
+		}
+
+		Fused->GridTimes = MoveTemp(GridTimes);
+		return Fused;
+	}
+
+	/** Builds the fused form of a supported curve asset, or null */
+	static TSharedPtr<FTimelineObjectFusedCurve> BuildFromAsset(const UCurveBase* Curve, uint32 Signature)
+	{
+		if (const UCurveVector* VectorCurve = Cast<UCurveVector>(Curve))
+		{
+			float EmptyValues[3];
+			for (int32 Channel = 0; Channel < 3; ++Channel)
+			{
+				const float DefaultValue = VectorCurve->FloatCurves[Channel].DefaultValue;
+				EmptyValues[Channel] = DefaultValue == MAX_flt ? 0.f : DefaultValue;
+			}
+			return Build(VectorCurve->FloatCurves, EmptyValues, 3, Signature);
+		}
+
+		if (const UCurveLinearColor* ColorCurve = Cast<UCurveLinearColor>(Curve))
+		{
+			// Adjusted colors go through HSV math the grid cannot express
+			const bool bDefaultAdjustments = ColorCurve->AdjustHue == 0.f && ColorCurve->AdjustSaturation == 1.f
+				&& ColorCurve->AdjustBrightness == 1.f && ColorCurve->AdjustBrightnessCurve == 1.f && ColorCurve->AdjustVibrance == 0.f
+				&& ColorCurve->AdjustMinAlpha == 0.f && ColorCurve->AdjustMaxAlpha == 1.f;
+			if (!bDefaultAdjustments)
+			{
+				return nullptr;
+			}
+
+			// Colors without alpha keys are opaque
+			float EmptyValues[4];
+			for (int32 Channel = 0; Channel < 3; ++Channel)
+			{
+				const float DefaultValue = ColorCurve->FloatCurves[Channel].DefaultValue;
+				EmptyValues[Channel] = DefaultValue == MAX_flt ? 0.f : DefaultValue;
+			}
+			EmptyValues[3] = 1.f;
+			TSharedPtr<FTimelineObjectFusedCurve> Fused = Build(ColorCurve->FloatCurves, EmptyValues, 4, Signature);
+
+			// The engine's HSV round trip differs from the channels once they go negative. Every value inside the grid
+			// lies within its segment's control points, so non-negative control points rule that out.
+			if (Fused)
+			{
+				for (const VectorRegister4Float& ControlPoint : Fused->ControlPoints)
+				{
+					float Lanes[4];
+					VectorStore(ControlPoint, Lanes);
+					if (Lanes[0] < 0.f || Lanes[1] < 0.f || Lanes[2] < 0.f)
+					{
+						return nullptr;
+					}
+				}
+			}
+			return Fused;
+		}
+
+		return nullptr;
+	}
+}
+
+bool FTimelineObjectFusedCurve::Eval(float InTime, int32& InOutSegmentIndex, float* OutValues) const
+{
+	// The last key is left to the source curve, which returns it exactly even after a stepped segment
+	const int32 NumGridTimes = GridTimes.Num();
+	if (InTime < GridTimes[0] || InTime >= GridTimes[NumGridTimes - 1])
+	{
+		return false;
+	}
+
+	int32 Segment = InOutSegmentIndex;
+	bool bFound = false;
+	if (Segment >= 0 && Segment < NumGridTimes - 1)
+	{
+		for (int32 Step = 0; Step <= TimelineObjectFusedCurve::MaxWalkSteps; ++Step)
+		{
+			if (InTime < GridTimes[Segment])
+			{
+				--Segment;
+			}
+			else if (InTime >= GridTimes[Segment + 1])
+			{
+				++Segment;
+			}
+			else
+			{
+				bFound = true;
+				break;
+			}
+		}
+	}
+
+	if (!bFound)
+	{
+		// Last grid time not greater than InTime
+		Segment = FMath::Clamp(Algo::UpperBound(GridTimes, InTime) - 1, 0, NumGridTimes - 2);
+	}
+	InOutSegmentIndex = Segment;
+
+	const float SegmentStart = GridTimes[Segment];
+	const float Alpha = (InTime - SegmentStart) / (GridTimes[Segment + 1] - SegmentStart);
+	const VectorRegister4Float VectorAlpha = VectorSetFloat1(Alpha);
+
+	// de Casteljau on all channels at once
+	const VectorRegister4Float* Points = &ControlPoints[Segment * 4];
+	const VectorRegister4Float P01 = VectorMultiplyAdd(VectorSubtract(Points[1], Points[0]), VectorAlpha, Points[0]);
+	const VectorRegister4Float P12 = VectorMultiplyAdd(VectorSubtract(Points[2], Points[1]), VectorAlpha, Points[1]);
+	const VectorRegister4Float P23 = VectorMultiplyAdd(VectorSubtract(Points[3], Points[2]), VectorAlpha, Points[2]);
+	const VectorRegister4Float P012 = VectorMultiplyAdd(VectorSubtract(P12, P01), VectorAlpha, P01);
+	const VectorRegister4Float P123 = VectorMultiplyAdd(VectorSubtract(P23, P12), VectorAlpha, P12);
+	VectorStore(VectorMultiplyAdd(VectorSubtract(P123, P012), VectorAlpha, P012), OutValues);
+	return true;
+}
+
+TSharedPtr<const FTimelineObjectFusedCurve> FTimelineObjectFusedCurveCache::FindOrBuild(const UCurveBase* Curve)
+{
+	check(IsInGameThread());
+
+	if (!Curve)
+	{
+		return nullptr;
+	}
+
+	using namespace TimelineObjectFusedCurve;
+	TMap<TObjectKey<UCurveBase>, FCacheEntry>& Cache = GetCache();
+
+	// Drop grids no track references anymore
+	for (auto It = Cache.CreateIterator(); It; ++It)
+	{
+		if (!It->Value.Curve.IsValid() || (!It->Value.Fused.IsValid() && !It->Value.UnsupportedSignature.IsSet()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	const uint32 Signature = FTimelineObjectBakedCurveCache::ComputeSourceSignature(Curve);
+	FCacheEntry& Entry = Cache.FindOrAdd(Curve);
+	if (Entry.UnsupportedSignature.IsSet() && Entry.UnsupportedSignature.GetValue() == Signature)
+	{
+		return nullptr;
+	}
+	if (TSharedPtr<const FTimelineObjectFusedCurve> Existing = Entry.Fused.Pin())
+	{
+		if (Existing->SourceSignature == Signature)
+		{
+			return Existing;
+		}
+	}
+
+	TSharedPtr<const FTimelineObjectFusedCurve> Fused = BuildFromAsset(Curve, Signature);
+	Entry.Curve = Curve;
+	Entry.Fused = Fused;
+	Entry.UnsupportedSignature.Reset();
+	if (!Fused)
+	{
+		Entry.UnsupportedSignature = Signature;
+	}
+	return Fused;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/VectorRegister.h"
+
+class UCurveBase;
+
+/**
+ * Vector or linear color curve with all channels merged onto one shared key grid.
+ * Each grid segment stores one cubic Bezier per channel, split from the source segments at registration,
+ * so a single key search and one SIMD de Casteljau evaluation produce every channel at once.
+ *
+ * Tolerance: within 1e-4 relative (1e-5 absolute near zero) of UCurveVector::GetVectorValue, and of
+ * UCurveLinearColor::GetLinearColorValue for colors with default adjustments and non-negative channels,
+ * where the engine's HSV round trip is the only difference.
+ */
+struct FTimelineObjectFusedCurve
+{
+	/** Union of the key times of all channels, ascending and unique */
+	TArray<float> GridTimes;
+
+	/** Four Bezier control points per grid segment, one channel per lane */
+	TArray<VectorRegister4Float> ControlPoints;
+
+	/** Number of channels in use: 3 for vector, 4 for linear color curves */
+	int32 NumChannels = 0;
+
+	/** Hash of the source keys the grid was built from */
+	uint32 SourceSignature = 0;
+
+	/**
+	 * Evaluates all channels at InTime, starting the grid search from InOutSegmentIndex.
+	 * @return false outside the grid, where the caller must use the source curve's extrapolation
+	 */
+	bool Eval(float InTime, int32& InOutSegmentIndex, float* OutValues) const;
+
+	/** Bytes used by the grid */
+	SIZE_T GetAllocatedSize() const { return GridTimes.GetAllocatedSize() + ControlPoints.GetAllocatedSize(); }
+};
+
+/**
+ * Process-wide cache of fused curves, keyed by curve asset and shared by every track using it.
+ */
+class FTimelineObjectFusedCurveCache
+{
+public:
+
+	/**
+	 * Returns the fused form of a vector or linear color curve, building it on first use.
+	 * Returns null for curves it cannot represent exactly: weighted tangents, cycling extrapolation inside the grid,
+	 * color adjustments, or color channels that go negative. Game thread only.
+	 */
+	static TSharedPtr<const FTimelineObjectFusedCurve> FindOrBuild(const UCurveBase* Curve);
+};
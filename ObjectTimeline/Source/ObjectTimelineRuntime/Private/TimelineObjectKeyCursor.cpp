@@ -0,0 +1,212 @@
+#include "TimelineObjectKeyCursor.h"
+
+namespace TimelineObjectKeyCursor
+{
+	/** Segments walked from the cursor before giving up and searching */
+	constexpr int32 MaxWalkSteps = 4;
+
+	/** Same predicate FRichCurve uses to pick its unweighted Bezier path */
+	static bool IsUnweighted(const FRichCurveKey& Key1, const FRichCurveKey& Key2)
+	{
+		return (Key1.TangentWeightMode == RCTWM_WeightedNone || Key1.TangentWeightMode == RCTWM_WeightedArrive)
+			&& (Key2.TangentWeightMode == RCTWM_WeightedNone || Key2.TangentWeightMode == RCTWM_WeightedLeave);
+	}
+
+	/** Lower bound over keys [1, NumKeys - 1], the search FRichCurve::Eval performs */
+	static int32 FindSegment(const TArray<FRichCurveKey>& Keys, float InTime)
+	{
+		int32 First = 1;
+		int32 Count = Keys.Num() - 2;
+		while (Count > 0)
+		{
+			const int32 Step = Count / 2;
+			const int32 Middle = First + Step;
+			if (InTime >= Keys[Middle].Time)
+			{
+				First = Middle + 1;
+				Count -= Step + 1;
+			}
+			else
+			{
+				Count = Step;
+			}
+		}
+		return First - 1;
+	}
+
+	/** Mirrors FRichCurve's evaluation between two keys, operation for operation so results match bit for bit */
+	static float EvalSegment(const FRichCurveKey& Key1, const FRichCurveKey& Key2, float InTime)
+	{
+		const float Diff = Key2.Time - Key1.Time;
+		if (Diff > 0.f && Key1.InterpMode != RCIM_Constant)
+		{
+			const float Alpha = (InTime - Key1.Time) / Diff;
+			const float P0 = Key1.Value;
+			const float P3 = Key2.Value;
+
+			if (Key1.InterpMode == RCIM_Linear)
+			{
+				return FMath::Lerp(P0, P3, Alpha);
+			}
+
+			const float OneThird = 1.0f / 3.0f;
+			const float P1 = P0 + (Key1.LeaveTangent * Diff * OneThird);
+			const float P2 = P3 - (Key2.ArriveTangent * Diff * OneThird);
+
+			const float P01 = FMath::Lerp(P0, P1, Alpha);
+			const float P12 = FMath::Lerp(P1, P2, Alpha);
+			const float P23 = FMath::Lerp(P2, P3, Alpha);
+			const float P012 = FMath::Lerp(P01, P12, Alpha);
+			const float P123 = FMath::Lerp(P12, P23, Alpha);
+			return FMath::Lerp(P012, P123, Alpha);
+		}
+		return Key1.Value;
+	}
+
+	/** Whether InTime is strictly inside the keyed range, where no extrapolation or cycling applies */
+	static bool IsInsideKeys(const TArray<FRichCurveKey>& Keys, float InTime)
+	{
+		return Keys.Num() >= 2 && InTime > Keys[0].Time && InTime < Keys.Last().Time;
+	}
+
+	/** Finds the segment containing InTime, walking from the cursor first. InTime must be inside the keys. */
+	static int32 FindSegmentFromCursor(const TArray<FRichCurveKey>& Keys, float InTime, int32& InOutSegmentIndex)
+	{
+		const int32 NumKeys = Keys.Num();
+
+		// InTime is strictly inside the keyed range, so walking never leaves [0, NumKeys - 2]
+		int32 Segment = InOutSegmentIndex;
+		bool bFound = false;
+		if (Segment >= 0 && Segment < NumKeys - 1)
+		{
+			for (int32 Step = 0; Step <= MaxWalkSteps; ++Step)
+			{
+				if (InTime < Keys[Segment].Time)
+				{
+					--Segment;
+				}
+				else if (InTime >= Keys[Segment + 1].Time)
+				{
+					++Segment;
+				}
+				else
+				{
+					bFound = true;
+					break;
+				}
+			}
+		}
+
+		if (!bFound)
+		{
+			Segment = FindSegment(Keys, InTime);
+		}
+		InOutSegmentIndex = Segment;
+		return Segment;
+	}
+
+	float Eval(const FRichCurve& Curve, float InTime, int32& InOutSegmentIndex)
+	{
+		const TArray<FRichCurveKey>& Keys = Curve.GetConstRefOfKeys();
+
+		// Extrapolation and cycling only happen outside the keyed range, leave them to the engine
+		if (!IsInsideKeys(Keys, InTime))
+		{
+			return Curve.Eval(InTime);
+		}
+
+		const int32 Segment = FindSegmentFromCursor(Keys, InTime, InOutSegmentIndex);
+		const FRichCurveKey& Key1 = Keys[Segment];
+		const FRichCurveKey& Key2 = Keys[Segment + 1];
+		if (Key1.InterpMode == RCIM_Cubic && !IsUnweighted(Key1, Key2))
+		{
+			return Curve.Eval(InTime);
+		}
+		return EvalSegment(Key1, Key2, InTime);
+	}
+
+	ETimelineObjectCurveShape Classify(const FRichCurve& Curve)
+	{
+		const TArray<FRichCurveKey>& Keys = Curve.GetConstRefOfKeys();
+		const int32 NumKeys = Keys.Num();
+		if (NumKeys < 2)
+		{
+			return ETimelineObjectCurveShape::Constant;
+		}
+
+		bool bFlat = true;
+		bool bAllStep = true;
+		bool bAllLinear = true;
+		for (int32 Index = 0; Index < NumKeys - 1; ++Index)
+		{
+			const FRichCurveKey& Key1 = Keys[Index];
+			const FRichCurveKey& Key2 = Keys[Index + 1];
+			bAllStep &= Key1.InterpMode == RCIM_Constant;
+			bAllLinear &= Key1.InterpMode == RCIM_Linear;
+
+			// Weighted segments solve for time numerically, so equal values alone do not guarantee an exact result
+			bFlat &= Key2.Value == Key1.Value;
+			if (Key1.InterpMode == RCIM_Cubic)
+			{
+				bFlat &= IsUnweighted(Key1, Key2) && Key1.LeaveTangent == 0.f && Key2.ArriveTangent == 0.f;
+			}
+		}
+
+		// Linear extrapolation follows the outer tangents unless the outer segment is linear
+		if (bFlat && Curve.PreInfinityExtrap == RCCE_Linear && Keys[0].InterpMode != RCIM_Linear)
+		{
+			bFlat &= Keys[0].ArriveTangent == 0.f;
+		}
+		if (bFlat && Curve.PostInfinityExtrap == RCCE_Linear && Keys[NumKeys - 2].InterpMode != RCIM_Linear)
+		{
+			bFlat &= Keys[NumKeys - 1].LeaveTangent == 0.f;
+		}
+
+		if (bFlat)
+		{
+			return ETimelineObjectCurveShape::Constant;
+		}
+		if (bAllLinear)
+		{
+			return NumKeys == 2 ? ETimelineObjectCurveShape::TwoKeyLinear : ETimelineObjectCurveShape::Linear;
+		}
+		return bAllStep ? ETimelineObjectCurveShape::Step : ETimelineObjectCurveShape::General;
+	}
+
+	float EvalShape(const FRichCurve& Curve, ETimelineObjectCurveShape Shape, float InTime, int32& InOutSegmentIndex)
+	{
+		const TArray<FRichCurveKey>& Keys = Curve.GetConstRefOfKeys();
+		if (Shape == ETimelineObjectCurveShape::General)
+		{
+			return Eval(Curve, InTime, InOutSegmentIndex);
+		}
+		if (Shape == ETimelineObjectCurveShape::Constant)
+		{
+			return Keys.Num() > 0 ? Keys[0].Value : Curve.Eval(InTime);
+		}
+		if (!IsInsideKeys(Keys, InTime))
+		{
+			return Curve.Eval(InTime);
+		}
+
+		switch (Shape)
+		{
+		case ETimelineObjectCurveShape::TwoKeyLinear:
+			return FMath::Lerp(Keys[0].Value, Keys[1].Value, (InTime - Keys[0].Time) / (Keys[1].Time - Keys[0].Time));
+
+		case ETimelineObjectCurveShape::Step:
+			return Keys[FindSegmentFromCursor(Keys, InTime, InOutSegmentIndex)].Value;
+
+		case ETimelineObjectCurveShape::Linear:
+		{
+			const int32 Segment = FindSegmentFromCursor(Keys, InTime, InOutSegmentIndex);
+			const FRichCurveKey& Key1 = Keys[Segment];
+			const FRichCurveKey& Key2 = Keys[Segment + 1];
+			return FMath::Lerp(Key1.Value, Key2.Value, (InTime - Key1.Time) / (Key2.Time - Key1.Time));
+		}
+
+		default:
+			return Eval(Curve, InTime, InOutSegmentIndex);
+		}
+	}
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Curves/RichCurve.h"
+#include "TimelineObjectTracks.h"
+
+/**
+ * Incremental FRichCurve evaluation for continuously playing timelines.
+ * Remembers the key segment of the previous evaluation and walks to a neighbouring segment instead of searching,
+ * falling back to a binary search after seeks, loop wraps or other large jumps.
+ * Results are identical to FRichCurve::Eval.
+ */
+namespace TimelineObjectKeyCursor
+{
+	/** Cursor value forcing a full search on the next evaluation */
+	constexpr int32 Invalid = INDEX_NONE;
+
+	/**
+	 * Evaluates the curve at InTime, starting the key search from InOutSegmentIndex and updating it.
+	 * Extrapolated times and weighted tangents are delegated to FRichCurve::Eval.
+	 */
+	float Eval(const FRichCurve& Curve, float InTime, int32& InOutSegmentIndex);
+
+	/**
+	 * Classifies the key layout of a curve. Constant means the value is the same at every time,
+	 * including the extrapolated range, so the curve can be evaluated once.
+	 */
+	ETimelineObjectCurveShape Classify(const FRichCurve& Curve);
+
+	/**
+	 * Evaluates the curve at InTime through the evaluator specialized for its shape, as returned by Classify.
+	 * Results are identical to FRichCurve::Eval.
+	 */
+	float EvalShape(const FRichCurve& Curve, ETimelineObjectCurveShape Shape, float InTime, int32& InOutSegmentIndex);
+}
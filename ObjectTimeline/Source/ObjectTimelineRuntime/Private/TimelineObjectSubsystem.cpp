@@ -0,0 +1,828 @@
+#include "TimelineObjectSubsystem.h"
+#include "ObjectTimelineStats.h"
+#include "TimelineObject.h"
+#include "Async/ParallelFor.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "SignificanceManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("TimelineObject Tick"), STAT_TimelineObjectTick, STATGROUP_ObjectTimeline);
+DECLARE_CYCLE_STAT(TEXT("TimelineObject Evaluate"), STAT_TimelineObjectEvaluate, STATGROUP_ObjectTimeline);
+DECLARE_CYCLE_STAT(TEXT("TimelineObject Dispatch"), STAT_TimelineObjectDispatch, STATGROUP_ObjectTimeline);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Registered Timelines"), STAT_TimelineObjectsRegistered, STATGROUP_ObjectTimeline);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Timelines"), STAT_TimelineObjectsActive, STATGROUP_ObjectTimeline);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Idle Timelines"), STAT_TimelineObjectsIdle, STATGROUP_ObjectTimeline);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Reduced LOD Timelines"), STAT_TimelineObjectsReducedLOD, STATGROUP_ObjectTimeline);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Suspended LOD Timelines"), STAT_TimelineObjectsSuspendedLOD, STATGROUP_ObjectTimeline);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deferred Updates"), STAT_TimelineObjectsDeferred, STATGROUP_ObjectTimeline);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Fixed Substeps"), STAT_TimelineObjectsSubsteps, STATGROUP_ObjectTimeline);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Deferred Updates (Total)"), STAT_TimelineObjectsDeferredTotal, STATGROUP_ObjectTimeline);
+
+static TAutoConsoleVariable<float> CVarTimelineObjectLODUpdateInterval(
+	TEXT("ObjectTimeline.LODUpdateInterval"),
+	0.25f,
+	TEXT("Seconds between LOD evaluations of a timeline using a LOD policy."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarTimelineObjectFrameBudgetMs(
+	TEXT("ObjectTimeline.FrameBudgetMs"),
+	0.f,
+	TEXT("Per-frame milliseconds for timeline updates and delegate dispatch. Cosmetic timelines over budget are deferred round-robin. 0 disables."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarTimelineObjectParallelEvaluation(
+	TEXT("ObjectTimeline.ParallelEvaluation"),
+	1,
+	TEXT("0: evaluate the curve tracks of a tick group serially. 1: evaluate them with ParallelFor. Delegates are dispatched serially either way."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarTimelineObjectParallelEvaluationMinBatchSize(
+	TEXT("ObjectTimeline.ParallelEvaluationMinBatchSize"),
+	16,
+	TEXT("Minimum number of timelines evaluated per parallel task."),
+	ECVF_Default);
+
+#pragma region FTimelineObjectTickFunction
+
+void FTimelineObjectTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Subsystem && Bucket)
+	{
+		Subsystem->TickBucket(*Bucket, DeltaTime);
+	}
+}
+
+FString FTimelineObjectTickFunction::DiagnosticMessage()
+{
+	return FString::Printf(TEXT("UTimelineObjectSubsystem[%s]"), *UEnum::GetValueAsString(TickGroup.GetValue()));
+}
+
+FName FTimelineObjectTickFunction::DiagnosticContext(bool bDetailed)
+{
+	return FName(TEXT("TimelineObjectSubsystem"));
+}
+
+#pragma endregion
+
+#pragma region Registration
+
+void UTimelineObjectSubsystem::RegisterTimeline(UTimelineObject* Timeline)
+{
+	if (Timeline)
+	{
+		++NumRegisteredTimelines;
+	}
+}
+
+void UTimelineObjectSubsystem::UnregisterTimeline(UTimelineObject* Timeline)
+{
+	if (Timeline)
+	{
+		DeactivateTimeline(Timeline);
+		NumRegisteredTimelines = FMath::Max(NumRegisteredTimelines - 1, 0);
+	}
+}
+
+void UTimelineObjectSubsystem::ActivateTimeline(UTimelineObject* Timeline)
+{
+	if (!Timeline || Timeline->ActiveTimelineIndex != INDEX_NONE)
+	{
+		return;
+	}
+
+	if (FTimelineObjectTickBucket* Bucket = FindOrCreateBucket(Timeline->TickGroup))
+	{
+		Timeline->ActiveTimelineIndex = Bucket->ActiveTimelines.Add(Timeline);
+		Timeline->AccumulatedDeltaTime = 0.f;
+		Timeline->TimeUntilNextUpdate = Timeline->TickInterval > 0.f ? GetStaggeredUpdateDelay(Timeline->TickInterval) : 0.f;
+		Timeline->TimeUntilLODUpdate = 0.f;
+		Timeline->FixedStepRemainder = 0.f;
+		if (Bucket->ActiveTimelines.Num() == 1)
+		{
+			Bucket->TickFunction.SetTickFunctionEnable(true);
+		}
+	}
+}
+
+void UTimelineObjectSubsystem::DeactivateTimeline(UTimelineObject* Timeline)
+{
+	if (!Timeline || Timeline->ActiveTimelineIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	const int32 BucketIndex = SanitizeTickGroup(Timeline->TickGroup);
+	if (!Buckets.IsValidIndex(BucketIndex) || !Buckets[BucketIndex])
+	{
+		return;
+	}
+
+	FTimelineObjectTickBucket& Bucket = *Buckets[BucketIndex];
+	const int32 RemovedIndex = Timeline->ActiveTimelineIndex;
+	if (!Bucket.ActiveTimelines.IsValidIndex(RemovedIndex) || Bucket.ActiveTimelines[RemovedIndex] != Timeline)
+	{
+		return;
+	}
+
+	// Swap the last active timeline into the freed slot and patch its index
+	Bucket.ActiveTimelines.RemoveAtSwap(RemovedIndex, 1, EAllowShrinking::No);
+	if (Bucket.ActiveTimelines.IsValidIndex(RemovedIndex))
+	{
+		Bucket.ActiveTimelines[RemovedIndex]->ActiveTimelineIndex = RemovedIndex;
+	}
+	Timeline->ActiveTimelineIndex = INDEX_NONE;
+
+	// An empty bucket drops out of the tick graph entirely
+	if (Bucket.ActiveTimelines.Num() == 0)
+	{
+		Bucket.TickFunction.SetTickFunctionEnable(false);
+	}
+}
+
+int32 UTimelineObjectSubsystem::GetNumActiveTimelines() const
+{
+	int32 NumActive = 0;
+	for (const TUniquePtr<FTimelineObjectTickBucket>& Bucket : Buckets)
+	{
+		if (Bucket)
+		{
+			NumActive += Bucket->ActiveTimelines.Num();
+		}
+	}
+	return NumActive;
+}
+
+#pragma endregion
+
+#pragma region Tick Groups
+
+namespace TimelineObjectSubsystemPrerequisites
+{
+	/** Drops the reference counts and tick prerequisites of destroyed actors */
+	static void PruneStalePrerequisites(FTimelineObjectTickBucket& Bucket)
+	{
+		for (auto It = Bucket.PrerequisiteActors.CreateIterator(); It; ++It)
+		{
+			if (!It->Key.IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+		Bucket.TickFunction.GetPrerequisites().RemoveAll([](const FTickPrerequisite& Prerequisite) { return !Prerequisite.PrerequisiteObject.IsValid(); });
+	}
+}
+
+void UTimelineObjectSubsystem::AddBucketPrerequisite(ETickingGroup TickGroup, AActor* PrerequisiteActor)
+{
+	if (!PrerequisiteActor)
+	{
+		return;
+	}
+
+	if (FTimelineObjectTickBucket* Bucket = FindOrCreateBucket(TickGroup))
+	{
+		TimelineObjectSubsystemPrerequisites::PruneStalePrerequisites(*Bucket);
+
+		int32& RefCount = Bucket->PrerequisiteActors.FindOrAdd(PrerequisiteActor);
+		if (RefCount++ == 0)
+		{
+			Bucket->TickFunction.AddPrerequisite(PrerequisiteActor, PrerequisiteActor->PrimaryActorTick);
+		}
+	}
+}
+
+void UTimelineObjectSubsystem::RemoveBucketPrerequisite(ETickingGroup TickGroup, TWeakObjectPtr<AActor> PrerequisiteActor)
+{
+	const int32 BucketIndex = SanitizeTickGroup(TickGroup);
+	if (PrerequisiteActor.IsExplicitlyNull() || !Buckets.IsValidIndex(BucketIndex) || !Buckets[BucketIndex])
+	{
+		return;
+	}
+
+	// Destroyed actors are still found by their weak key, so their reference count is released like any other
+	FTimelineObjectTickBucket& Bucket = *Buckets[BucketIndex];
+	int32* RefCount = Bucket.PrerequisiteActors.Find(PrerequisiteActor);
+	if (RefCount && --(*RefCount) <= 0)
+	{
+		Bucket.PrerequisiteActors.Remove(PrerequisiteActor);
+		if (AActor* Actor = PrerequisiteActor.Get())
+		{
+			Bucket.TickFunction.RemovePrerequisite(Actor, Actor->PrimaryActorTick);
+		}
+	}
+	TimelineObjectSubsystemPrerequisites::PruneStalePrerequisites(Bucket);
+}
+
+ETickingGroup UTimelineObjectSubsystem::SanitizeTickGroup(ETickingGroup TickGroup)
+{
+	// TG_NewlySpawned is an internal pseudo-group and cannot host tick functions
+	if (TickGroup >= TG_NewlySpawned)
+	{
+		return TG_PrePhysics;
+	}
+	return TickGroup;
+}
+
+float UTimelineObjectSubsystem::GetStaggeredUpdateDelay(float TickInterval)
+{
+	// Golden ratio sequence: consecutive activations land far apart within the interval
+	StaggerSequence = FMath::Frac(StaggerSequence + 0.61803398875f);
+	return TickInterval * StaggerSequence;
+}
+
+FTimelineObjectTickBucket* UTimelineObjectSubsystem::FindOrCreateBucket(ETickingGroup TickGroup)
+{
+	const int32 BucketIndex = SanitizeTickGroup(TickGroup);
+	if (Buckets.Num() <= BucketIndex)
+	{
+		Buckets.SetNum(BucketIndex + 1);
+	}
+
+	if (!Buckets[BucketIndex])
+	{
+		UWorld* World = GetWorld();
+		if (!World || !World->PersistentLevel)
+		{
+			return nullptr;
+		}
+
+		TUniquePtr<FTimelineObjectTickBucket> NewBucket = MakeUnique<FTimelineObjectTickBucket>();
+		FTimelineObjectTickFunction& TickFunction = NewBucket->TickFunction;
+		TickFunction.Subsystem = this;
+		TickFunction.Bucket = NewBucket.Get();
+		TickFunction.TickGroup = static_cast<ETickingGroup>(BucketIndex);
+		TickFunction.EndTickGroup = static_cast<ETickingGroup>(BucketIndex);
+		TickFunction.bCanEverTick = true;
+		TickFunction.bStartWithTickEnabled = false;
+		TickFunction.bTickEvenWhenPaused = false;
+		TickFunction.bAllowTickOnDedicatedServer = true;
+		TickFunction.RegisterTickFunction(World->PersistentLevel);
+
+		Buckets[BucketIndex] = MoveTemp(NewBucket);
+	}
+
+	return Buckets[BucketIndex].Get();
+}
+
+void UTimelineObjectSubsystem::BeginFrameIfNeeded(float DeltaTime)
+{
+	if (LastBeginFrameCounter == GFrameCounter)
+	{
+		return;
+	}
+	LastBeginFrameCounter = GFrameCounter;
+
+	// Undilated delta is the same for every timeline ignoring time dilation, compute it once per frame
+	FrameDeltaTime = DeltaTime;
+	FrameUndilatedDeltaTime = FApp::GetDeltaTime();
+	if (const AWorldSettings* WorldSettings = GetWorld()->GetWorldSettings())
+	{
+		FrameUndilatedDeltaTime = FMath::Clamp(FrameUndilatedDeltaTime, WorldSettings->MinUndilatedFrameTime, WorldSettings->MaxUndilatedFrameTime);
+	}
+
+	// Each clock domain scales the frame delta once, instead of every subscribed timeline doing it
+	for (FTimelineObjectClockDomain& Domain : ClockDomains)
+	{
+		RefreshClockDomain(Domain);
+	}
+
+	// Frame budget is shared by all tick group buckets
+	const float FrameBudgetMs = CVarTimelineObjectFrameBudgetMs.GetValueOnGameThread();
+	FrameBudgetCycles = FrameBudgetMs > 0.f ? static_cast<uint64>(FrameBudgetMs / (FPlatformTime::GetSecondsPerCycle64() * 1000.0)) : 0;
+	FrameBudgetUsedCycles = 0;
+	NumDeferredUpdates = 0;
+}
+
+bool UTimelineObjectSubsystem::ConsumeUpdateDelta(UTimelineObject& Timeline, float DeltaTime, float& OutDeltaTime)
+{
+	Timeline.AccumulatedDeltaTime += DeltaTime;
+
+	// A LOD left over from a policy that no longer applies must not freeze or throttle the timeline
+	const ETimelineObjectLOD LOD = Timeline.UsesLOD() ? Timeline.CurrentLOD : ETimelineObjectLOD::Full;
+	if (LOD == ETimelineObjectLOD::Suspended)
+	{
+		// Suspended timelines only wake up to finish on time, never to evaluate intermediate frames
+		if (!Timeline.WouldFinishWithin(Timeline.AccumulatedDeltaTime))
+		{
+			return false;
+		}
+	}
+	else
+	{
+		float TickInterval = Timeline.TickInterval;
+		if (LOD == ETimelineObjectLOD::Reduced && Timeline.LODSettings.ReducedUpdateRate > 0.f)
+		{
+			TickInterval = FMath::Max(TickInterval, 1.f / Timeline.LODSettings.ReducedUpdateRate);
+		}
+
+		if (TickInterval > 0.f)
+		{
+			Timeline.TimeUntilNextUpdate -= DeltaTime;
+			if (Timeline.TimeUntilNextUpdate > 0.f)
+			{
+				return false;
+			}
+
+			// Keep the staggered phase even when a long frame overshoots several intervals
+			Timeline.TimeUntilNextUpdate = FMath::Fmod(Timeline.TimeUntilNextUpdate, TickInterval) + TickInterval;
+		}
+	}
+
+	OutDeltaTime = Timeline.AccumulatedDeltaTime;
+	Timeline.AccumulatedDeltaTime = 0.f;
+	return true;
+}
+
+const FTimelineObjectClockDomain& UTimelineObjectSubsystem::GetTimelineClockDomain(const UTimelineObject& Timeline) const
+{
+	return ClockDomains.IsValidIndex(Timeline.ClockDomainIndex) ? ClockDomains[Timeline.ClockDomainIndex] : ClockDomains[0];
+}
+
+void UTimelineObjectSubsystem::UpdateTimelineLOD(UTimelineObject& Timeline, float DeltaTime)
+{
+	Timeline.TimeUntilLODUpdate -= DeltaTime;
+	if (Timeline.TimeUntilLODUpdate <= 0.f)
+	{
+		// Jitter around the interval so timelines activated together spread their evaluations
+		const float LODUpdateInterval = FMath::Max(CVarTimelineObjectLODUpdateInterval.GetValueOnGameThread(), 0.f);
+		Timeline.TimeUntilLODUpdate = LODUpdateInterval > 0.f ? GetStaggeredUpdateDelay(LODUpdateInterval) + LODUpdateInterval * 0.5f : 0.f;
+
+		const ETimelineObjectLOD NewLOD = EvaluateLOD(Timeline);
+		if (NewLOD < Timeline.CurrentLOD)
+		{
+			// Catch up right away: the accumulated time is applied in one update, firing every skipped event
+			Timeline.TimeUntilNextUpdate = 0.f;
+		}
+		Timeline.CurrentLOD = NewLOD;
+	}
+
+	if (Timeline.CurrentLOD == ETimelineObjectLOD::Reduced)
+	{
+		INC_DWORD_STAT(STAT_TimelineObjectsReducedLOD);
+	}
+	else if (Timeline.CurrentLOD == ETimelineObjectLOD::Suspended)
+	{
+		INC_DWORD_STAT(STAT_TimelineObjectsSuspendedLOD);
+	}
+}
+
+ETimelineObjectLOD UTimelineObjectSubsystem::EvaluateLOD(UTimelineObject& Timeline)
+{
+	// Owner-supplied decision wins, this is the only rule for non-actor owners such as widgets
+	if (Timeline.SignificanceCallback.IsBound())
+	{
+		return Timeline.SignificanceCallback.Execute(&Timeline);
+	}
+	if (Timeline.SignificanceFunction.IsBound())
+	{
+		return Timeline.SignificanceFunction.Execute(&Timeline);
+	}
+
+	const FTimelineObjectLODSettings& Settings = Timeline.LODSettings;
+	AActor* OwningActor = Timeline.GetOwningActor();
+	if (!Settings.bEnableLOD || !OwningActor)
+	{
+		return ETimelineObjectLOD::Full;
+	}
+
+	// Defer to the game's significance rules when the owner is registered with the Significance Manager
+	if (const USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld()))
+	{
+		float Significance = 0.f;
+		if (SignificanceManager->QuerySignificance(OwningActor, Significance))
+		{
+			if (Significance < Settings.SuspendedSignificance)
+			{
+				return ETimelineObjectLOD::Suspended;
+			}
+			return Significance < Settings.ReducedSignificance ? ETimelineObjectLOD::Reduced : ETimelineObjectLOD::Full;
+		}
+	}
+
+	// Without local viewpoints (dedicated server) distance and visibility carry no meaning
+	const TArray<FVector>& ViewLocations = GetLocalViewLocations();
+	if (ViewLocations.Num() == 0)
+	{
+		return ETimelineObjectLOD::Full;
+	}
+
+	const FVector OwnerLocation = OwningActor->GetActorLocation();
+	float MinDistanceSquared = MAX_flt;
+	for (const FVector& ViewLocation : ViewLocations)
+	{
+		MinDistanceSquared = FMath::Min(MinDistanceSquared, static_cast<float>(FVector::DistSquared(OwnerLocation, ViewLocation)));
+	}
+
+	if (Settings.SuspendedDistance > 0.f && MinDistanceSquared > FMath::Square(Settings.SuspendedDistance))
+	{
+		return ETimelineObjectLOD::Suspended;
+	}
+
+	ETimelineObjectLOD LOD = ETimelineObjectLOD::Full;
+	if (Settings.ReducedDistance > 0.f && MinDistanceSquared > FMath::Square(Settings.ReducedDistance))
+	{
+		LOD = ETimelineObjectLOD::Reduced;
+	}
+
+	// Actors that never rendered (no primitives) are judged by distance only
+	if (Settings.NotRenderedTimeout > 0.f && OwningActor->GetLastRenderTime() > 0.f && !OwningActor->WasRecentlyRendered(Settings.NotRenderedTimeout))
+	{
+		if (Settings.NotRenderedLOD > LOD)
+		{
+			LOD = Settings.NotRenderedLOD;
+		}
+	}
+
+	return LOD;
+}
+
+const TArray<FVector>& UTimelineObjectSubsystem::GetLocalViewLocations()
+{
+	if (LocalViewLocationsFrameCounter != GFrameCounter)
+	{
+		LocalViewLocationsFrameCounter = GFrameCounter;
+		LocalViewLocations.Reset();
+
+		for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+		{
+			const APlayerController* PlayerController = It->Get();
+			if (PlayerController && PlayerController->IsLocalController())
+			{
+				FVector ViewLocation;
+				FRotator ViewRotation;
+				PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+				LocalViewLocations.Add(ViewLocation);
+			}
+		}
+	}
+
+	return LocalViewLocations;
+}
+
+bool UTimelineObjectSubsystem::UpdateTimeline(UTimelineObject& Timeline, bool bRespectFrameBudget)
+{
+	// Skip timelines deactivated by an earlier callback this frame
+	if (Timeline.ActiveTimelineIndex == INDEX_NONE)
+	{
+		return true;
+	}
+
+	// Paused domains freeze their timelines entirely, without accumulating time or firing updates
+	const FTimelineObjectClockDomain& Domain = GetTimelineClockDomain(Timeline);
+	if (Domain.bPaused)
+	{
+		return true;
+	}
+
+	// LOD was updated by the bucket tick before any timeline advanced
+	const float FrameDeltaTime = (Timeline.bIgnoreTimeDilation || Domain.bIgnoreTimeDilation) ? Domain.UndilatedDeltaTime : Domain.DeltaTime;
+	float TimelineDeltaTime = 0.f;
+	if (!ConsumeUpdateDelta(Timeline, FrameDeltaTime, TimelineDeltaTime))
+	{
+		return true;
+	}
+
+	if (bRespectFrameBudget && IsFrameBudgetExhausted())
+	{
+		// Hand the time back; the timeline is first in line next frame and loses no playback time
+		Timeline.AccumulatedDeltaTime = TimelineDeltaTime;
+		Timeline.TimeUntilNextUpdate = 0.f;
+		++NumDeferredUpdates;
+		INC_DWORD_STAT(STAT_TimelineObjectsDeferred);
+		INC_DWORD_STAT(STAT_TimelineObjectsDeferredTotal);
+		return false;
+	}
+
+	const uint64 StartCycles = FrameBudgetCycles > 0 ? FPlatformTime::Cycles64() : 0;
+
+	Timeline.bDeferUpdateDispatch = bDeferDispatch;
+	AdvanceTimeline(Timeline, TimelineDeltaTime);
+	Timeline.bDeferUpdateDispatch = false;
+
+	const bool bHasPendingCallbacks = Timeline.PendingUpdatePositions.Num() > 0 || Timeline.bFinishPending;
+	if (bHasPendingCallbacks)
+	{
+		PendingDispatchTimelines.Add(&Timeline);
+	}
+
+	if (FrameBudgetCycles > 0)
+	{
+		// Deferred callbacks run later; charge what they cost last time so the budget decision stays honest
+		FrameBudgetUsedCycles += FPlatformTime::Cycles64() - StartCycles;
+		if (bHasPendingCallbacks)
+		{
+			FrameBudgetUsedCycles += Timeline.EstimatedDispatchCycles;
+		}
+	}
+
+	if (!Timeline.TheTimeline.IsPlaying())
+	{
+		DeactivateTimeline(&Timeline);
+	}
+	return true;
+}
+
+void UTimelineObjectSubsystem::AdvanceTimeline(UTimelineObject& Timeline, float DeltaTime)
+{
+	if (Timeline.FixedTimestep <= 0.f)
+	{
+		Timeline.TheTimeline.TickTimeline(DeltaTime);
+		return;
+	}
+
+	const float Step = Timeline.FixedTimestep;
+	const float TotalTime = Timeline.FixedStepRemainder + DeltaTime;
+	const int32 NumWholeSteps = FMath::FloorToInt32(TotalTime / Step);
+	Timeline.FixedStepRemainder = TotalTime - NumWholeSteps * Step;
+
+	// Past the cap, the excess whole steps go into the last substep so a hitch cannot snowball into more work
+	const int32 NumSubsteps = FMath::Min(NumWholeSteps, Timeline.MaxSubsteps);
+	for (int32 Substep = 0; Substep < NumSubsteps; ++Substep)
+	{
+		const int32 StepsThisSubstep = Substep == NumSubsteps - 1 ? NumWholeSteps - Substep : 1;
+
+		// Earlier substeps flush their pending update when the next one moves the position, so every position is dispatched
+		Timeline.TheTimeline.TickTimeline(Step * StepsThisSubstep);
+		INC_DWORD_STAT(STAT_TimelineObjectsSubsteps);
+
+		if (!Timeline.TheTimeline.IsPlaying())
+		{
+			Timeline.FixedStepRemainder = 0.f;
+			break;
+		}
+	}
+}
+
+bool UTimelineObjectSubsystem::IsFrameBudgetExhausted() const
+{
+	return FrameBudgetCycles > 0 && FrameBudgetUsedCycles >= FrameBudgetCycles;
+}
+
+void UTimelineObjectSubsystem::TickBucket(FTimelineObjectTickBucket& Bucket, float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_TimelineObjectTick);
+
+	if (Bucket.ActiveTimelines.Num() == 0)
+	{
+		return;
+	}
+
+	BeginFrameIfNeeded(DeltaTime);
+
+	bDeferDispatch = true;
+	TickingTimelines = Bucket.ActiveTimelines;
+	const int32 NumTicking = TickingTimelines.Num();
+
+	// Significance functions may run Blueprint code that starts, stops or reprioritizes timelines,
+	// so all of them run before the first timeline advances and the loops below see a settled set
+	for (UTimelineObject* Timeline : TickingTimelines)
+	{
+		if (Timeline->ActiveTimelineIndex != INDEX_NONE && Timeline->UsesLOD())
+		{
+			const FTimelineObjectClockDomain& Domain = GetTimelineClockDomain(*Timeline);
+			if (!Domain.bPaused)
+			{
+				UpdateTimelineLOD(*Timeline, (Timeline->bIgnoreTimeDilation || Domain.bIgnoreTimeDilation) ? Domain.UndilatedDeltaTime : Domain.DeltaTime);
+			}
+		}
+	}
+
+	// Gameplay-critical timelines always update, and their cost counts against the budget
+	bool bHasCosmeticTimelines = false;
+	for (UTimelineObject* Timeline : TickingTimelines)
+	{
+		if (Timeline->UpdatePriority == ETimelineObjectPriority::Cosmetic)
+		{
+			bHasCosmeticTimelines = true;
+			continue;
+		}
+		UpdateTimeline(*Timeline, false);
+	}
+
+	// Cosmetic timelines update round-robin until the budget runs out, starting with last frame's first deferral
+	if (bHasCosmeticTimelines)
+	{
+		const int32 StartIndex = Bucket.CosmeticCursor < NumTicking ? Bucket.CosmeticCursor : 0;
+		int32 FirstDeferredIndex = INDEX_NONE;
+
+		for (int32 Offset = 0; Offset < NumTicking; ++Offset)
+		{
+			const int32 Index = (StartIndex + Offset) % NumTicking;
+			UTimelineObject* Timeline = TickingTimelines[Index];
+			if (Timeline->UpdatePriority != ETimelineObjectPriority::Cosmetic)
+			{
+				continue;
+			}
+
+			if (!UpdateTimeline(*Timeline, true) && FirstDeferredIndex == INDEX_NONE)
+			{
+				FirstDeferredIndex = Index;
+			}
+		}
+
+		Bucket.CosmeticCursor = FirstDeferredIndex != INDEX_NONE ? FirstDeferredIndex : 0;
+	}
+
+	TickingTimelines.Reset();
+
+	bDeferDispatch = false;
+	EvaluatePendingTimelines();
+	DispatchPendingTimelines();
+}
+
+void UTimelineObjectSubsystem::EvaluatePendingTimelines()
+{
+	SCOPE_CYCLE_COUNTER(STAT_TimelineObjectEvaluate);
+
+	if (PendingDispatchTimelines.Num() == 0)
+	{
+		return;
+	}
+
+	const uint64 StartCycles = FrameBudgetCycles > 0 ? FPlatformTime::Cycles64() : 0;
+
+	// Each task only writes the track values of its own timeline; curve assets are read-only here.
+	// Timelines with several updates this frame (loop wraps, substeps) evaluate each one as it is dispatched.
+	const int32 MinBatchSize = FMath::Max(CVarTimelineObjectParallelEvaluationMinBatchSize.GetValueOnGameThread(), 1);
+	const EParallelForFlags Flags = CVarTimelineObjectParallelEvaluation.GetValueOnGameThread() != 0 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+	ParallelFor(TEXT("TimelineObjectEvaluate"), PendingDispatchTimelines.Num(), MinBatchSize, [this](int32 Index)
+	{
+		UTimelineObject& Timeline = *PendingDispatchTimelines[Index];
+		if (Timeline.PendingUpdatePositions.Num() == 1)
+		{
+			Timeline.EvaluateTracks(Timeline.PendingUpdatePositions[0]);
+			Timeline.bPendingValuesEvaluated = true;
+		}
+	}, Flags);
+
+	if (FrameBudgetCycles > 0)
+	{
+		FrameBudgetUsedCycles += FPlatformTime::Cycles64() - StartCycles;
+	}
+}
+
+void UTimelineObjectSubsystem::DispatchPendingTimelines()
+{
+	SCOPE_CYCLE_COUNTER(STAT_TimelineObjectDispatch);
+
+	// Callbacks may start or stop other timelines; those dispatch immediately and are skipped here once flushed
+	for (int32 Index = 0; Index < PendingDispatchTimelines.Num(); ++Index)
+	{
+		UTimelineObject& Timeline = *PendingDispatchTimelines[Index];
+		if (FrameBudgetCycles > 0)
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			Timeline.DispatchPendingCallbacks();
+			const uint64 DispatchCycles = FPlatformTime::Cycles64() - StartCycles;
+
+			// Replace the estimate charged while advancing with the measured cost
+			FrameBudgetUsedCycles -= FMath::Min(Timeline.EstimatedDispatchCycles, FrameBudgetUsedCycles);
+			FrameBudgetUsedCycles += DispatchCycles;
+			Timeline.EstimatedDispatchCycles = DispatchCycles;
+		}
+		else
+		{
+			Timeline.DispatchPendingCallbacks();
+		}
+	}
+
+	PendingDispatchTimelines.Reset();
+}
+
+#pragma endregion
+
+#pragma region Clock Domains
+
+void UTimelineObjectSubsystem::SetClockDomainTimeScale(FName DomainName, float TimeScale)
+{
+	FTimelineObjectClockDomain& Domain = ClockDomains[FindOrAddClockDomain(DomainName)];
+	Domain.TimeScale = FMath::Max(TimeScale, 0.f);
+	RefreshClockDomain(Domain);
+}
+
+float UTimelineObjectSubsystem::GetClockDomainTimeScale(FName DomainName) const
+{
+	const FTimelineObjectClockDomain* Domain = FindClockDomain(DomainName);
+	return Domain ? Domain->TimeScale : 1.f;
+}
+
+void UTimelineObjectSubsystem::SetClockDomainPaused(FName DomainName, bool bPaused)
+{
+	FTimelineObjectClockDomain& Domain = ClockDomains[FindOrAddClockDomain(DomainName)];
+	Domain.bPaused = bPaused;
+	RefreshClockDomain(Domain);
+}
+
+bool UTimelineObjectSubsystem::IsClockDomainPaused(FName DomainName) const
+{
+	const FTimelineObjectClockDomain* Domain = FindClockDomain(DomainName);
+	return Domain && Domain->bPaused;
+}
+
+void UTimelineObjectSubsystem::SetClockDomainIgnoreTimeDilation(FName DomainName, bool bIgnoreTimeDilation)
+{
+	FTimelineObjectClockDomain& Domain = ClockDomains[FindOrAddClockDomain(DomainName)];
+	Domain.bIgnoreTimeDilation = bIgnoreTimeDilation;
+	RefreshClockDomain(Domain);
+}
+
+bool UTimelineObjectSubsystem::GetClockDomainIgnoreTimeDilation(FName DomainName) const
+{
+	const FTimelineObjectClockDomain* Domain = FindClockDomain(DomainName);
+	return Domain && Domain->bIgnoreTimeDilation;
+}
+
+int32 UTimelineObjectSubsystem::FindOrAddClockDomain(FName DomainName)
+{
+	const int32 ExistingIndex = ClockDomains.IndexOfByPredicate([DomainName](const FTimelineObjectClockDomain& Domain)
+	{
+		return Domain.Name == DomainName;
+	});
+	if (ExistingIndex != INDEX_NONE)
+	{
+		return ExistingIndex;
+	}
+
+	// Domains are never removed, so indices cached on timelines stay valid
+	FTimelineObjectClockDomain& NewDomain = ClockDomains.AddDefaulted_GetRef();
+	NewDomain.Name = DomainName;
+	RefreshClockDomain(NewDomain);
+	return ClockDomains.Num() - 1;
+}
+
+void UTimelineObjectSubsystem::RefreshClockDomain(FTimelineObjectClockDomain& Domain) const
+{
+	const float TimeScale = Domain.bPaused ? 0.f : Domain.TimeScale;
+	Domain.DeltaTime = FrameDeltaTime * TimeScale;
+	Domain.UndilatedDeltaTime = FrameUndilatedDeltaTime * TimeScale;
+}
+
+const FTimelineObjectClockDomain* UTimelineObjectSubsystem::FindClockDomain(FName DomainName) const
+{
+	return ClockDomains.FindByPredicate([DomainName](const FTimelineObjectClockDomain& Domain)
+	{
+		return Domain.Name == DomainName;
+	});
+}
+
+#pragma endregion
+
+#pragma region UTickableWorldSubsystem Interface
+
+void UTimelineObjectSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// The default domain follows each timeline's own time dilation setting
+	FindOrAddClockDomain(NAME_None);
+}
+
+void UTimelineObjectSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Timelines advance in their tick group buckets, this tick only publishes counters
+	const int32 NumActive = GetNumActiveTimelines();
+	SET_DWORD_STAT(STAT_TimelineObjectsRegistered, NumRegisteredTimelines);
+	SET_DWORD_STAT(STAT_TimelineObjectsActive, NumActive);
+	SET_DWORD_STAT(STAT_TimelineObjectsIdle, NumRegisteredTimelines - NumActive);
+}
+
+TStatId UTimelineObjectSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UTimelineObjectSubsystem, STATGROUP_Tickables);
+}
+
+void UTimelineObjectSubsystem::Deinitialize()
+{
+	for (TUniquePtr<FTimelineObjectTickBucket>& Bucket : Buckets)
+	{
+		if (Bucket)
+		{
+			for (UTimelineObject* Timeline : Bucket->ActiveTimelines)
+			{
+				Timeline->ActiveTimelineIndex = INDEX_NONE;
+			}
+			Bucket->TickFunction.UnRegisterTickFunction();
+		}
+	}
+	Buckets.Empty();
+	TickingTimelines.Empty();
+	PendingDispatchTimelines.Empty();
+	NumRegisteredTimelines = 0;
+
+	Super::Deinitialize();
+}
+
+bool UTimelineObjectSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	// Timelines never tick in editor worlds
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+#pragma endregion
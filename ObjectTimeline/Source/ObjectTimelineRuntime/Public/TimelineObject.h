@@ -2,14 +2,16 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
+#include "UObject/ObjectKey.h"
 #include "Components/TimelineComponent.h"
-#include "Tickable.h"
+#include "TimelineObjectTracks.h"
 #include "TimelineObject.generated.h"
 
 class UTimelineTemplate;
 class UCurveFloat;
 class UCurveVector;
 class UCurveLinearColor;
+class UTimelineObjectSubsystem;
 
 #pragma region Delegates
 
@@ -17,19 +19,132 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnTimelineObjectEvent);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTimelineObjectFloatTrack, FName, TrackName, float, Value);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTimelineObjectVectorTrack, FName, TrackName, FVector, Value);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTimelineObjectLinearColorTrack, FName, TrackName, FLinearColor, Value);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTimelineObjectEventsSkipped, int32, NumEvents);
+
+/** Native counterparts for C++ listeners, broadcast without ProcessEvent or parameter marshaling */
+DECLARE_MULTICAST_DELEGATE(FOnTimelineObjectEventNative);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnTimelineObjectFloatTrackNative, FName /*TrackName*/, float /*Value*/);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnTimelineObjectVectorTrackNative, FName /*TrackName*/, const FVector& /*Value*/);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnTimelineObjectLinearColorTrackNative, FName /*TrackName*/, const FLinearColor& /*Value*/);
+
+#pragma endregion
+
+#pragma region Seeking
+
+/** How SetPlaybackPosition with bFireEvents reports the events it jumps over */
+UENUM(BlueprintType)
+enum class ETimelineObjectSeekEvents : uint8
+{
+	/** Every crossed event fires, in the order of the jump */
+	FireAll,
+	/** Crossed events are not fired; OnEventsSkipped reports how many there were */
+	Coalesce
+};
+
+#pragma endregion
+
+#pragma region Scheduling
+
+/** Scheduling class of a timeline under the tick manager's frame budget */
+UENUM(BlueprintType)
+enum class ETimelineObjectPriority : uint8
+{
+	/** Always updated, regardless of the frame budget */
+	Critical,
+	/** Deferred round-robin to later frames when the frame budget is exhausted */
+	Cosmetic
+};
+
+#pragma endregion
+
+#pragma region LOD
+
+/** Update fidelity of a timeline, decided by its LOD policy */
+UENUM(BlueprintType)
+enum class ETimelineObjectLOD : uint8
+{
+	/** Updates every frame, or at its own tick interval */
+	Full,
+	/** Updates at FTimelineObjectLODSettings::ReducedUpdateRate */
+	Reduced,
+	/** Not evaluated; time keeps accumulating and is caught up when the timeline returns to a higher LOD */
+	Suspended
+};
+
+DECLARE_DELEGATE_RetVal_OneParam(ETimelineObjectLOD, FTimelineObjectSignificanceDelegate, const UTimelineObject*);
+DECLARE_DYNAMIC_DELEGATE_RetVal_OneParam(ETimelineObjectLOD, FTimelineObjectSignificanceDynamicDelegate, UTimelineObject*, Timeline);
+
+/**
+ * LOD policy of a timeline.
+ * The LOD is decided by the owner-supplied significance callback when bound, otherwise by the Significance Manager
+ * when the owning actor is registered with it, otherwise by distance to local viewpoints and recent rendering.
+ */
+USTRUCT(BlueprintType)
+struct FTimelineObjectLODSettings
+{
+	GENERATED_BODY()
+
+	/** Enables the LOD policy for this timeline */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timeline")
+	bool bEnableLOD = false;
+
+	/** Distance from the closest local viewpoint beyond which the timeline is reduced, 0 disables */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timeline")
+	float ReducedDistance = 3000.f;
+
+	/** Distance from the closest local viewpoint beyond which the timeline is suspended, 0 disables */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timeline")
+	float SuspendedDistance = 10000.f;
+
+	/** Seconds without rendering after which the owning actor counts as not visible, 0 ignores visibility */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timeline")
+	float NotRenderedTimeout = 1.f;
+
+	/** LOD used while the owning actor is not visible */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timeline")
+	ETimelineObjectLOD NotRenderedLOD = ETimelineObjectLOD::Reduced;
+
+	/** Significance Manager values below this are reduced */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timeline")
+	float ReducedSignificance = 0.5f;
+
+	/** Significance Manager values below this are suspended */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timeline")
+	float SuspendedSignificance = 0.f;
+
+	/** Updates per second while reduced */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timeline")
+	float ReducedUpdateRate = 10.f;
+};
+
+#pragma endregion
+
+#pragma region Getter Memoization
+
+/** Curve value remembered by the value getters for the current playback position */
+struct FTimelineObjectGetterMemo
+{
+	/** Curve the value belongs to */
+	TObjectKey<UCurveBase> Curve;
+
+	/** Value in X for float curves, XYZ for vector curves, XYZW for color curves */
+	FVector4 Value;
+};
 
 #pragma endregion
 
 /**
  * Timeline object that can be used with any UObject-derived class.
  * Unlike UTimelineComponent, this is not restricted to Actors.
- * Implements FTickableGameObject for autonomous ticking when playing.
+ * Ticking is driven by the world's UTimelineObjectSubsystem, which advances all timelines in one batched loop.
  */
 UCLASS(BlueprintType, Blueprintable)
-class OBJECTTIMELINERUNTIME_API UTimelineObject : public UObject, public FTickableGameObject
+class OBJECTTIMELINERUNTIME_API UTimelineObject : public UObject
 {
 	GENERATED_BODY()
 
+	friend class UTimelineObjectSubsystem;
+
 public:
 	UTimelineObject();
 
@@ -66,9 +181,17 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Timeline")
 	float GetPlaybackPosition() const;
 
+	/** Moves the playback position without firing events, like FTimeline::SetNewTime */
 	UFUNCTION(BlueprintCallable, Category = "Timeline")
 	void SetNewTime(float NewTime);
 
+	/** Chooses whether seeks with bFireEvents fire every event they jump over or report them as one OnEventsSkipped */
+	UFUNCTION(BlueprintCallable, Category = "Timeline")
+	void SetSeekEventMode(ETimelineObjectSeekEvents NewMode);
+
+	UFUNCTION(BlueprintPure, Category = "Timeline")
+	ETimelineObjectSeekEvents GetSeekEventMode() const;
+
 	UFUNCTION(BlueprintPure, Category = "Timeline")
 	float GetTimelineLength() const;
 
@@ -78,6 +201,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Timeline")
 	void SetTimelineLength(float NewLength);
 
+	/** In TL_LastKeyFrame mode the length is computed when tracks change, not on every tick */
 	UFUNCTION(BlueprintCallable, Category = "Timeline")
 	void SetTimelineLengthMode(ETimelineLengthMode NewLengthMode);
 
@@ -108,6 +232,90 @@ public:
 
 #pragma endregion
 
+#pragma region Tick Settings
+
+	/** Sets the tick group this timeline advances in. Timelines initialized from a template use its TimelineTickGroup. */
+	UFUNCTION(BlueprintCallable, Category = "Timeline")
+	void SetTickGroup(TEnumAsByte<ETickingGroup> NewTickGroup);
+
+	UFUNCTION(BlueprintPure, Category = "Timeline")
+	TEnumAsByte<ETickingGroup> GetTickGroup() const;
+
+	/**
+	 * Makes this timeline's tick group wait for the given actor's primary tick, e.g. its owning actor.
+	 * Prerequisites apply to every timeline sharing the tick group in this world.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Timeline")
+	void AddTickPrerequisiteActor(AActor* PrerequisiteActor);
+
+	UFUNCTION(BlueprintCallable, Category = "Timeline")
+	void RemoveTickPrerequisiteActor(AActor* PrerequisiteActor);
+
+	/**
+	 * Sets the minimum time in seconds between updates, 0 updates every frame.
+	 * Skipped frame time is accumulated and applied on the next update, so playback position stays exact.
+	 * Throttled timelines are staggered across frames by the tick manager.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Timeline")
+	void SetTickInterval(float NewTickInterval);
+
+	UFUNCTION(BlueprintPure, Category = "Timeline")
+	float GetTickInterval() const;
+
+	/** Caps the number of updates per second, 0 removes the cap. Equivalent to SetTickInterval(1 / MaxUpdateRate). */
+	UFUNCTION(BlueprintCallable, Category = "Timeline")
+	void SetMaxUpdateRate(float MaxUpdateRate);
+
+	/**
+	 * Advances this timeline in fixed steps of NewFixedTimestep seconds, 0 disables.
+	 * Large frame deltas are split into substeps so event tracks and update delegates see every intermediate position,
+	 * independent of frame rate. Time short of a full step carries over to the next frame.
+	 * At most NewMaxSubsteps run per frame; any excess is folded into the last substep.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Timeline")
+	void SetFixedTimestep(float NewFixedTimestep, int32 NewMaxSubsteps = 8);
+
+	UFUNCTION(BlueprintPure, Category = "Timeline")
+	float GetFixedTimestep() const;
+
+	/** Sets whether this timeline may be deferred when ObjectTimeline.FrameBudgetMs is exhausted */
+	UFUNCTION(BlueprintCallable, Category = "Timeline")
+	void SetUpdatePriority(ETimelineObjectPriority NewUpdatePriority);
+
+	UFUNCTION(BlueprintPure, Category = "Timeline")
+	ETimelineObjectPriority GetUpdatePriority() const;
+
+	/**
+	 * Subscribes this timeline to a named clock domain such as "UI" or "Cinematic".
+	 * The domain's time scale, pause state and time dilation policy apply on top of this timeline's own play rate.
+	 * NAME_None selects the default domain.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Timeline")
+	void SetClockDomain(FName NewClockDomain);
+
+	UFUNCTION(BlueprintPure, Category = "Timeline")
+	FName GetClockDomain() const;
+
+	/** Sets the LOD policy used to lower update frequency for distant or unseen owners */
+	UFUNCTION(BlueprintCallable, Category = "Timeline")
+	void SetLODSettings(const FTimelineObjectLODSettings& NewLODSettings);
+
+	UFUNCTION(BlueprintPure, Category = "Timeline")
+	const FTimelineObjectLODSettings& GetLODSettings() const;
+
+	/** Current LOD as last evaluated by the tick manager */
+	UFUNCTION(BlueprintPure, Category = "Timeline")
+	ETimelineObjectLOD GetCurrentLOD() const;
+
+	/** Lets non-actor owners such as widgets decide the LOD. Takes precedence over every other rule. */
+	void SetSignificanceCallback(FTimelineObjectSignificanceDelegate NewSignificanceCallback);
+
+	/** Blueprint version of SetSignificanceCallback */
+	UFUNCTION(BlueprintCallable, Category = "Timeline")
+	void SetSignificanceFunction(FTimelineObjectSignificanceDynamicDelegate NewSignificanceFunction);
+
+#pragma endregion
+
 #pragma region Curve Management
 
 	UFUNCTION(BlueprintCallable, Category = "Timeline")
@@ -119,15 +327,34 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Timeline")
 	void SetLinearColorCurve(UCurveLinearColor* NewLinearColorCurve, FName LinearColorTrackName);
 
+	/**
+	 * Bakes the curve of every track into a lookup table sampled SampleRate times per second, 0 restores exact evaluation.
+	 * Tables are shared by all timelines using the same curve at the same rate. See GetTrackBakeError for the accuracy.
+	 * Timelines created from a template bake automatically when ObjectTimeline.BakeCurveSampleRate is set.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Timeline")
+	void SetCurveBakeSampleRate(float SampleRate);
+
+	UFUNCTION(BlueprintPure, Category = "Timeline")
+	float GetCurveBakeSampleRate() const;
+
+	/** Largest measured difference between the baked table of the track and its curve, 0 when the track is not baked */
+	UFUNCTION(BlueprintPure, Category = "Timeline")
+	float GetTrackBakeError(FName TrackName) const;
+
+	/** Adds an event to the same schedule as the event tracks. It fires when playback crosses Time, like an event track key. */
 	UFUNCTION(BlueprintCallable, Category = "Timeline")
 	void AddEvent(float Time, FOnTimelineEvent EventFunc);
 
+	/** InterpFunc runs inline while the tick manager advances the bucket, so it must not play, stop, seek or reprioritize timelines. Track subscriptions are dispatched safely. */
 	UFUNCTION(BlueprintCallable, Category = "Timeline")
 	void AddInterpVector(UCurveVector* VectorCurve, FOnTimelineVector InterpFunc, FName PropertyName = NAME_None, FName TrackName = NAME_None);
 
+	/** InterpFunc runs inline while the tick manager advances the bucket, so it must not play, stop, seek or reprioritize timelines. Track subscriptions are dispatched safely. */
 	UFUNCTION(BlueprintCallable, Category = "Timeline")
 	void AddInterpFloat(UCurveFloat* FloatCurve, FOnTimelineFloat InterpFunc, FName PropertyName = NAME_None, FName TrackName = NAME_None);
 
+	/** InterpFunc runs inline while the tick manager advances the bucket, so it must not play, stop, seek or reprioritize timelines. Track subscriptions are dispatched safely. */
 	UFUNCTION(BlueprintCallable, Category = "Timeline")
 	void AddInterpLinearColor(UCurveLinearColor* LinearColorCurve, FOnTimelineLinearColor InterpFunc, FName PropertyName = NAME_None, FName TrackName = NAME_None);
 
@@ -135,6 +362,7 @@ public:
 
 #pragma region Value Getters
 
+	/** Value of the curve at the playback position, read from the track value cache when the curve belongs to a track */
 	UFUNCTION(BlueprintPure, Category = "Timeline")
 	float GetFloatValue(UCurveFloat* FloatCurve) const;
 
@@ -157,12 +385,15 @@ public:
 
 #pragma region Property Binding
 
+	/** Interp and direction properties are written while the tick manager advances the bucket, so their setters must not drive timelines. */
 	UFUNCTION(BlueprintCallable, Category = "Timeline")
 	void SetPropertySetObject(UObject* NewPropertySetObject);
 
+	/** Called after OnTimelineUpdate with every dispatched update. Replaces the previous post update func. */
 	UFUNCTION(BlueprintCallable, Category = "Timeline")
 	void SetTimelinePostUpdateFunc(FOnTimelineEvent NewTimelinePostUpdateFunc);
 
+	/** Called after OnTimelineFinished when playback finishes. Replaces the previous finished func. */
 	UFUNCTION(BlueprintCallable, Category = "Timeline")
 	void SetTimelineFinishedFunc(FOnTimelineEvent NewTimelineFinishedFunc);
 
@@ -177,6 +408,9 @@ public:
 
 	void GetAllCurves(TSet<class UCurveBase*>& InOutCurves) const;
 
+	/** Logs the memory held by the curve assets every live timeline references, next to the baked tables and fused grids built from them. */
+	static void ReportCurveMemory(FOutputDevice& Ar);
+
 	UFUNCTION(BlueprintPure, Category = "Timeline")
 	AActor* GetOwningActor() const;
 
@@ -203,33 +437,57 @@ public:
 
 #pragma endregion
 
-#pragma region Dynamic Binding
+#pragma region Track Subscriptions
 
+	/**
+	 * Listens to one float track. Unlike OnFloatTrack, the delegate is only called for this track's values.
+	 * Returns an invalid handle when the timeline has no float track of that name.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Timeline")
-	void BindUpdateFunction(UObject* Target, FName FunctionName);
+	FTimelineObjectTrackHandle BindFloatTrack(FName TrackName, FOnTimelineObjectFloatValue Delegate);
 
 	UFUNCTION(BlueprintCallable, Category = "Timeline")
-	void BindFinishedFunction(UObject* Target, FName FunctionName);
+	FTimelineObjectTrackHandle BindVectorTrack(FName TrackName, FOnTimelineObjectVectorValue Delegate);
 
 	UFUNCTION(BlueprintCallable, Category = "Timeline")
-	void BindEventTrackFunction(FName TrackName, UObject* Target, FName FunctionName);
+	FTimelineObjectTrackHandle BindLinearColorTrack(FName TrackName, FOnTimelineObjectLinearColorValue Delegate);
+
+	/** Native versions of the Bind*Track functions, for C++ listeners */
+	FTimelineObjectTrackHandle AddFloatTrackListener(FName TrackName, FOnTimelineObjectFloatValueNative::FDelegate Delegate);
+	FTimelineObjectTrackHandle AddVectorTrackListener(FName TrackName, FOnTimelineObjectVectorValueNative::FDelegate Delegate);
+	FTimelineObjectTrackHandle AddLinearColorTrackListener(FName TrackName, FOnTimelineObjectLinearColorValueNative::FDelegate Delegate);
+
+	/** Removes a track subscription and invalidates the handle */
+	UFUNCTION(BlueprintCallable, Category = "Timeline")
+	void UnbindTrack(UPARAM(ref) FTimelineObjectTrackHandle& Handle);
+
+	/**
+	 * Counts a reader of the named curve track, such as a connected Blueprint pin, which keeps it evaluated every update.
+	 * Tracks without listeners, pin readers or a getter read since the previous update are not evaluated while
+	 * ObjectTimeline.SkipUnobservedTracks is set. Timelines created from a template register their pins once, on creation.
+	 * Pin readers are never removed: the pins belong to the owner's class and live as long as the timeline.
+	 */
+	void AddTrackPinReader(FName TrackName);
 
 #pragma endregion
 
-#pragma region FTickableGameObject Interface
+#pragma region Dynamic Binding
+
+	UFUNCTION(BlueprintCallable, Category = "Timeline")
+	void BindUpdateFunction(UObject* Target, FName FunctionName);
+
+	UFUNCTION(BlueprintCallable, Category = "Timeline")
+	void BindFinishedFunction(UObject* Target, FName FunctionName);
 
-	virtual void Tick(float DeltaTime) override;
-	virtual bool IsTickable() const override;
-	virtual bool IsTickableInEditor() const override;
-	virtual bool IsTickableWhenPaused() const override;
-	virtual TStatId GetStatId() const override;
-	virtual UWorld* GetTickableGameObjectWorld() const override;
+	UFUNCTION(BlueprintCallable, Category = "Timeline")
+	void BindEventTrackFunction(FName TrackName, UObject* Target, FName FunctionName);
 
 #pragma endregion
 
 #pragma region UObject Overrides
 
 	virtual UWorld* GetWorld() const override;
+	virtual void PostInitProperties() override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	virtual bool IsSupportedForNetworking() const override;
 	virtual int32 GetFunctionCallspace(UFunction* Function, FFrame* Stack) override;
@@ -255,6 +513,27 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Timeline")
 	FOnTimelineObjectLinearColorTrack OnLinearColorTrack;
 
+	/** Fired by seeks in ETimelineObjectSeekEvents::Coalesce mode with the number of events jumped over */
+	UPROPERTY(BlueprintAssignable, Category = "Timeline")
+	FOnTimelineObjectEventsSkipped OnEventsSkipped;
+
+#pragma endregion
+
+#pragma region Native Delegates
+
+	/**
+	 * C++ listeners of the same callbacks as the dynamic delegates above. Within each callback,
+	 * native listeners run before dynamic ones. See the Native Dispatch and Dynamic Dispatch stats for their cost.
+	 */
+	FOnTimelineObjectEventNative& OnUpdateNative() { return OnTimelineUpdateNative; }
+	FOnTimelineObjectEventNative& OnFinishedNative() { return OnTimelineFinishedNative; }
+	FOnTimelineObjectFloatTrackNative& OnFloatTrackNative() { return OnFloatTrackNativeDelegate; }
+	FOnTimelineObjectVectorTrackNative& OnVectorTrackNative() { return OnVectorTrackNativeDelegate; }
+	FOnTimelineObjectLinearColorTrackNative& OnLinearColorTrackNative() { return OnLinearColorTrackNativeDelegate; }
+
+	/** Native listeners of an event track, fired together with GetEventTrackDelegate */
+	FOnTimelineObjectEventNative& GetEventTrackNativeDelegate(FName TrackName);
+
 #pragma endregion
 
 protected:
@@ -265,39 +544,188 @@ protected:
 	UPROPERTY(ReplicatedUsing = OnRep_Timeline)
 	FTimeline TheTimeline;
 
+	/** Length mode requested by the user. TheTimeline always runs in TL_TimelineLength with the resolved length. */
+	TEnumAsByte<ETimelineLengthMode> LengthMode = TL_TimelineLength;
+
+	/** Length set through SetTimelineLength, used in TL_TimelineLength mode */
+	float FixedTimelineLength = 5.f;
+
 	UPROPERTY()
 	bool bIgnoreTimeDilation;
 
-	/** Track name to curve mappings for runtime access */
+	/** Curve tracks with their evaluated values, stored contiguously so evaluation can run off the game thread */
 	UPROPERTY(Transient)
-	TMap<FName, TObjectPtr<UCurveFloat>> FloatTrackCurves;
-	
+	TArray<FTimelineObjectFloatTrack> FloatTracks;
+
 	UPROPERTY(Transient)
-	TMap<FName, TObjectPtr<UCurveVector>> VectorTrackCurves;
-	
+	TArray<FTimelineObjectVectorTrack> VectorTracks;
+
 	UPROPERTY(Transient)
-	TMap<FName, TObjectPtr<UCurveLinearColor>> LinearColorTrackCurves;
+	TArray<FTimelineObjectLinearColorTrack> LinearColorTracks;
+
+	/** Sample rate curve tracks are baked at, 0 when tracks evaluate their curves directly */
+	float CurveBakeSampleRate = 0.f;
+
+	/** Tracks whose curves have fewer keys than this are not baked */
+	int32 CurveBakeMinKeys = 2;
 
+	/** Event tracks in registration order, which is also the firing order of keys at the same time */
 	UPROPERTY(Transient)
-	TMap<FName, TObjectPtr<UCurveFloat>> EventTrackCurves;
+	TArray<FTimelineObjectEventTrack> EventTracks;
 
 	/** Event track delegates keyed by track name */
 	TMap<FName, FOnTimelineObjectEvent> EventTrackDelegates;
+	TMap<FName, FOnTimelineObjectEventNative> EventTrackNativeDelegates;
 
-	/** Tracks last position for each event track to detect key crossings */
-	TMap<FName, float> LastEventTrackPositions;
+	/** Track subscriptions by handle id */
+	TMap<int32, FTimelineObjectTrackSubscription> TrackSubscriptions;
+
+	/** Id of the next track subscription */
+	int32 NextTrackHandleId = 0;
+
+	/** Native delegates behind the Native Delegates accessors */
+	FOnTimelineObjectEventNative OnTimelineUpdateNative;
+	FOnTimelineObjectEventNative OnTimelineFinishedNative;
+	FOnTimelineObjectFloatTrackNative OnFloatTrackNativeDelegate;
+	FOnTimelineObjectVectorTrackNative OnVectorTrackNativeDelegate;
+	FOnTimelineObjectLinearColorTrackNative OnLinearColorTrackNativeDelegate;
+
+	/** Funcs set with SetTimelinePostUpdateFunc and SetTimelineFinishedFunc. The FTimeline funcs stay bound to the internal callbacks. */
+	FOnTimelineEvent UserPostUpdateFunc;
+	FOnTimelineEvent UserFinishedFunc;
+	FOnTimelineEventStatic UserFinishedFuncStatic;
+
+	/** Events added with AddEvent, with their times */
+	TArray<TPair<float, FOnTimelineEvent>> AddedEvents;
+
+	/**
+	 * Every event track key and added event sorted by time, searched once per update.
+	 * At equal times event track keys come first in track order, then added events in the order they were added.
+	 */
+	TArray<FTimelineObjectScheduledEvent> EventSchedule;
+
+	/** Position event tracks were last checked at, key crossings are measured from here */
+	float LastEventPosition = 0.f;
+
+	/** Whether LastEventPosition is set, the first update only establishes it */
+	bool bHasEventBaseline = false;
+
+	/** Set while SetPlaybackPosition or SetNewTime moves the timeline, so a backward jump is not taken for a loop wrap */
+	bool bSeekingPlayback = false;
+
+	/** Whether the seek in progress fires the events it crosses */
+	bool bSeekFiresEvents = false;
+
+	/** How seeks with bFireEvents report crossed events */
+	UPROPERTY()
+	ETimelineObjectSeekEvents SeekEventMode = ETimelineObjectSeekEvents::FireAll;
+
+	/** Time of the next scheduled event in the playback direction from LastEventPosition, +-MAX_flt when none */
+	float NextEventTime = 0.f;
+
+	/** Whether NextEventTime is usable, cleared by seeks, direction and rate changes and schedule edits */
+	bool bEventHorizonValid = false;
+
+	/** Playback direction NextEventTime was computed for */
+	bool bEventHorizonReversed = false;
 
 	/** Track bound functions to prevent duplicate bindings */
 	TSet<TPair<TWeakObjectPtr<UObject>, FName>> BoundUpdateFunctions;
 	TSet<TPair<TWeakObjectPtr<UObject>, FName>> BoundFinishedFunctions;
 	TMap<FName, TSet<TPair<TWeakObjectPtr<UObject>, FName>>> BoundEventTrackFunctions;
 
+	/** Playback position the cached track values were evaluated at */
+	float TrackValuesPosition = 0.f;
+
+	/** Whether the cached track values are usable, cleared whenever tracks change */
+	bool bTrackValuesValid = false;
+
+	/** Values returned by the getters at GetterMemoPosition, including curves that are not tracks */
+	mutable TArray<FTimelineObjectGetterMemo, TInlineAllocator<4>> GetterMemos;
+
+	/** Playback position GetterMemos belong to */
+	mutable float GetterMemoPosition = 0.f;
+
 	/** Cached world reference for reliable ticking with non-Actor owners */
 	TWeakObjectPtr<UWorld> CachedWorld;
 
+	/** Tick manager this timeline is registered with */
+	TWeakObjectPtr<UTimelineObjectSubsystem> TickSubsystem;
+
+	/** Slot in the tick manager's active set, INDEX_NONE while stopped */
+	int32 ActiveTimelineIndex = INDEX_NONE;
+
+	/** Tick group whose bucket advances this timeline */
+	UPROPERTY()
+	TEnumAsByte<ETickingGroup> TickGroup = TG_PrePhysics;
+
+	/** Actors whose primary tick must complete before this timeline's tick group bucket runs */
+	TArray<TWeakObjectPtr<AActor>> TickPrerequisiteActors;
+
+	/** Minimum seconds between updates, 0 updates every frame */
+	UPROPERTY()
+	float TickInterval = 0.f;
+
+	/** Clock domain this timeline is subscribed to */
+	UPROPERTY()
+	FName ClockDomain;
+
+	/** Index of ClockDomain in the tick manager, resolved on registration */
+	int32 ClockDomainIndex = 0;
+
+	/** Fixed substep length in seconds, 0 advances by the whole update delta */
+	UPROPERTY()
+	float FixedTimestep = 0.f;
+
+	/** Maximum fixed substeps per update */
+	UPROPERTY()
+	int32 MaxSubsteps = 8;
+
+	/** Time short of a full fixed step, carried over to the next update */
+	float FixedStepRemainder = 0.f;
+
+	/** Frame time accumulated since the last update */
+	float AccumulatedDeltaTime = 0.f;
+
+	/** Seconds left before the next throttled update */
+	float TimeUntilNextUpdate = 0.f;
+
+	/** Scheduling class under the frame budget */
+	UPROPERTY()
+	ETimelineObjectPriority UpdatePriority = ETimelineObjectPriority::Critical;
+
+	/** LOD policy */
+	UPROPERTY()
+	FTimelineObjectLODSettings LODSettings;
+
+	/** Owner-supplied LOD decision */
+	FTimelineObjectSignificanceDelegate SignificanceCallback;
+	FTimelineObjectSignificanceDynamicDelegate SignificanceFunction;
+
+	/** LOD as of the last evaluation */
+	ETimelineObjectLOD CurrentLOD = ETimelineObjectLOD::Full;
+
+	/** Seconds left before the LOD is evaluated again */
+	float TimeUntilLODUpdate = 0.f;
+
 	/** Deferred autoplay flag - Play() called after delegates are bound */
 	bool bPendingAutoPlay = false;
 
+	/** Set by the tick manager while advancing, so update and finished callbacks wait for its dispatch phase */
+	bool bDeferUpdateDispatch = false;
+
+	/** Positions of the update callbacks waiting for the dispatch phase, in playback order */
+	TArray<float, TInlineAllocator<2>> PendingUpdatePositions;
+
+	/** Track values were already evaluated at the only pending update position */
+	bool bPendingValuesEvaluated = false;
+
+	/** A finished callback is waiting to be dispatched after the pending updates */
+	bool bFinishPending = false;
+
+	/** Cost of the last dispatch, charged against the frame budget before the dispatch runs */
+	uint64 EstimatedDispatchCycles = 0;
+
 #pragma endregion
 
 #pragma region Internal Callbacks
@@ -311,8 +739,91 @@ protected:
 	UFUNCTION()
 	void Internal_OnTimelineFinished();
 
-	/** Checks all event tracks and fires delegates for any keys that were crossed */
-	void CheckEventTracks();
+	/** Fires every event track key crossed on the way to CurrentPosition, in playback order, splitting loop wraps */
+	void CheckEventTracks(float CurrentPosition);
+
+	/** Appends the scheduled events within [RangeStart, RangeEnd] in playback order, keeping the schedule order at equal times */
+	void CollectEventKeys(float RangeStart, float RangeEnd, bool bIncludeStart, bool bIncludeEnd, bool bDescending, TArray<FTimelineObjectScheduledEvent, TInlineAllocator<8>>& OutEvents) const;
+
+	/** Registers a subscription and returns its handle */
+	FTimelineObjectTrackHandle AddTrackSubscription(FName TrackName, ETimelineObjectTrackType TrackType, FDelegateHandle NativeHandle, const UObject* NativeOwner, const FScriptDelegate& DynamicDelegate);
+
+	/** Handle of the dynamic subscription already binding Delegate to the track, registering one if the track has it unrecorded */
+	FTimelineObjectTrackHandle FindOrAddDynamicTrackSubscription(FName TrackName, ETimelineObjectTrackType TrackType, const FScriptDelegate& Delegate);
+
+	/** Calls the per-track listeners of every curve track, native or dynamic */
+	void BroadcastTrackSubscribers(bool bNative) const;
+
+	/** Broadcasts every curve track value through the given float, vector and color delegates */
+	template <typename FloatDelegateType, typename VectorDelegateType, typename LinearColorDelegateType>
+	void BroadcastTrackValues(FloatDelegateType& FloatDelegate, VectorDelegateType& VectorDelegate, LinearColorDelegateType& LinearColorDelegate) const;
+
+	/** Fires the delegates of scheduled events in array order */
+	void FireScheduledEvents(TConstArrayView<FTimelineObjectScheduledEvent> Events);
+
+	/** Rebuilds EventSchedule from the event tracks and added events */
+	void RebuildEventSchedule();
+
+	/** Finds the next scheduled event ahead of LastEventPosition in the playback direction */
+	void UpdateEventHorizon();
+
+	/** Starts measuring key crossings from the current position if no update has done so yet */
+	void EnsureEventBaseline();
+
+	/** Evaluates every curve track at Position into its cached value. Touches no other state, safe off the game thread. */
+	void EvaluateTracks(float Position);
+
+	/** Broadcasts the cached track values, event tracks and the update delegate for Position */
+	void DispatchUpdate(float Position);
+
+	/** Broadcasts the finished delegate and syncs the active set */
+	void DispatchFinished();
+
+	/** Dispatches the update and finished callbacks deferred by the tick manager, in that order */
+	void DispatchPendingCallbacks();
+
+	/** Attaches the shared baked tables and fused grids each track evaluates through, after tracks or settings change */
+	void RefreshTrackEvaluators();
+
+	/** Recomputes the last keyframe time in TL_LastKeyFrame mode, after tracks or events change */
+	void RefreshTimelineLength();
+
+	/** True when the cached track values match the current playback position */
+	bool AreTrackValuesCurrent() const;
+
+	/** Returns the value a getter computed for the curve at the current position, or null */
+	const FVector4* FindGetterMemo(const UCurveBase* Curve) const;
+
+	/** Remembers a getter result until the playback position changes */
+	void AddGetterMemo(const UCurveBase* Curve, const FVector4& Value) const;
+
+	/** Makes the next evaluation of every track search its keys from scratch, after a seek */
+	void ResetKeyCursors();
+
+#pragma endregion
+
+#pragma region Tick Registration
+
+	/** Returns the world this timeline ticks in, preferring the cached world for non-Actor owners */
+	UWorld* GetTickWorld() const;
+
+	/** Registers with the tick manager of the tick world */
+	void RegisterWithTickSubsystem();
+
+	/** Unregisters from the tick manager, if registered */
+	void UnregisterFromTickSubsystem();
+
+	/** Adds or removes this timeline from the tick manager's active set to match IsPlaying() */
+	void UpdateTickActivation();
+
+	/** True when the LOD policy or a significance callback applies to this timeline */
+	bool UsesLOD() const;
+
+	/** Returns to full LOD once no LOD policy or significance callback applies, so nothing stays suspended or throttled */
+	void ResetLODIfUnused();
+
+	/** True when advancing by DeltaTime would reach the end of a non-looping timeline */
+	bool WouldFinishWithin(float DeltaTime) const;
 
 #pragma endregion
 };
\ No newline at end of file
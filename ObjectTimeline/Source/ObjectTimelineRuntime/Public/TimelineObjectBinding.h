@@ -6,7 +6,8 @@
 
 /**
  * Stores binding information for a single object timeline.
- * Maps timeline name to the generated function names for Update, Finished, and Event tracks.
+ * Maps timeline name to the generated function names for Update, Finished, and Event tracks,
+ * and lists the curve tracks read through pins.
  */
 USTRUCT()
 struct FTimelineObjectBindingEntry
@@ -28,6 +29,10 @@ struct FTimelineObjectBindingEntry
 	/** Maps event track names to their generated function names */
 	UPROPERTY()
 	TMap<FName, FName> EventTrackFunctionNames;
+
+	/** Curve tracks whose output pins are connected, registered as pin readers when the timeline is created */
+	UPROPERTY()
+	TArray<FName> ReadTrackNames;
 };
 
 /**
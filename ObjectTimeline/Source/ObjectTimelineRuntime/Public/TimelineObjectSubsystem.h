@@ -0,0 +1,291 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TimelineObjectSubsystem.generated.h"
+
+class UTimelineObject;
+class UTimelineObjectSubsystem;
+enum class ETimelineObjectLOD : uint8;
+struct FTimelineObjectTickBucket;
+
+/**
+ * Tick function driving one tick group bucket of UTimelineObjectSubsystem.
+ * Registered with the world's persistent level and only enabled while its bucket has playing timelines.
+ */
+USTRUCT()
+struct FTimelineObjectTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	/** Subsystem owning the bucket */
+	UTimelineObjectSubsystem* Subsystem = nullptr;
+
+	/** Bucket advanced by this tick function */
+	FTimelineObjectTickBucket* Bucket = nullptr;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+	virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FTimelineObjectTickFunction> : public TStructOpsTypeTraitsBase2<FTimelineObjectTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/**
+ * Playing timelines of one tick group and the tick function that advances them.
+ */
+struct FTimelineObjectTickBucket
+{
+	/** Tick function scheduled in this bucket's tick group */
+	FTimelineObjectTickFunction TickFunction;
+
+	/** Playing timelines. Not UPROPERTY: timelines are kept alive by their Outer and unregister in BeginDestroy. */
+	TArray<UTimelineObject*> ActiveTimelines;
+
+	/** Actors this bucket waits for, with the number of timelines requesting each */
+	TMap<TWeakObjectPtr<AActor>, int32> PrerequisiteActors;
+
+	/** Index where the next round-robin pass over cosmetic timelines starts */
+	int32 CosmeticCursor = 0;
+};
+
+/**
+ * Named clock shared by a group of timelines.
+ * Its frame delta is computed once per frame and applied to every timeline subscribed to it.
+ */
+struct FTimelineObjectClockDomain
+{
+	/** Domain name, NAME_None for the default domain */
+	FName Name;
+
+	/** Multiplier applied to the frame delta of every subscribed timeline */
+	float TimeScale = 1.f;
+
+	/** Paused domains do not advance their timelines at all */
+	bool bPaused = false;
+
+	/** Subscribed timelines use the undilated frame delta, regardless of their own setting */
+	bool bIgnoreTimeDilation = false;
+
+	/** Scaled dilated delta of the current frame */
+	float DeltaTime = 0.f;
+
+	/** Scaled undilated delta of the current frame */
+	float UndilatedDeltaTime = 0.f;
+};
+
+/**
+ * World-level tick manager for UTimelineObject.
+ * Keeps an explicit set of playing timelines per tick group and advances each set in a single batched loop,
+ * driven by one FTickFunction per tick group so timelines honor UTimelineTemplate::TimelineTickGroup.
+ * Stopped timelines are not part of any active set and cost nothing per frame.
+ * When ObjectTimeline.FrameBudgetMs is set, cosmetic timelines are deferred round-robin once the budget is spent.
+ * A bucket tick runs in three phases: advance every timeline, evaluate curve tracks
+ * (with ParallelFor under ObjectTimeline.ParallelEvaluation), then flush one dispatch queue on the game thread.
+ * The advance phase calls no timeline object delegate. The exception is what FTimeline itself drives while it
+ * advances: AddInterpFloat/Vector/LinearColor funcs, the float, vector and color property writes of
+ * SetPropertySetObject and the SetDirectionPropertyName write. They run inline in the middle of the bucket,
+ * so their funcs and property setters must not play, stop, seek or reprioritize any timeline.
+ *
+ * Dispatch order: timelines in the order they were advanced (critical first, then cosmetic round-robin).
+ * Per timeline, every update of the frame in playback order, including loop wraps and fixed substeps.
+ * Each update broadcasts float, vector and color tracks, then the crossed event keys, then OnTimelineUpdate.
+ * OnTimelineFinished comes last. Timelines started or stopped by a handler take effect from their next update.
+ */
+UCLASS()
+class OBJECTTIMELINERUNTIME_API UTimelineObjectSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+	friend struct FTimelineObjectTickFunction;
+
+public:
+
+#pragma region Registration
+
+	/** Starts managing the given timeline. Safe to call more than once. */
+	void RegisterTimeline(UTimelineObject* Timeline);
+
+	/** Stops managing the given timeline and removes it from the active set */
+	void UnregisterTimeline(UTimelineObject* Timeline);
+
+	/** Adds the timeline to the active set of its tick group so it is advanced every frame */
+	void ActivateTimeline(UTimelineObject* Timeline);
+
+	/** Removes the timeline from the active set. O(1), safe to call while ticking. */
+	void DeactivateTimeline(UTimelineObject* Timeline);
+
+	/** Number of timelines currently managed by this subsystem */
+	int32 GetNumRegisteredTimelines() const { return NumRegisteredTimelines; }
+
+	/** Number of timelines advanced every frame, across all tick groups */
+	int32 GetNumActiveTimelines() const;
+
+	/** Number of cosmetic timeline updates deferred by the frame budget during the current frame */
+	int32 GetNumDeferredUpdates() const { return NumDeferredUpdates; }
+
+#pragma endregion
+
+#pragma region Tick Groups
+
+	/** Makes the bucket of the given tick group wait for the actor's primary tick. Reference counted. */
+	void AddBucketPrerequisite(ETickingGroup TickGroup, AActor* PrerequisiteActor);
+
+	/** Releases one reference taken by AddBucketPrerequisite, also for actors destroyed since */
+	void RemoveBucketPrerequisite(ETickingGroup TickGroup, TWeakObjectPtr<AActor> PrerequisiteActor);
+
+	/** Clamps tick groups that cannot host a bucket to a valid one */
+	static ETickingGroup SanitizeTickGroup(ETickingGroup TickGroup);
+
+	/** Returns a delay in [0, TickInterval) that spreads throttled timelines evenly across frames */
+	float GetStaggeredUpdateDelay(float TickInterval);
+
+#pragma endregion
+
+#pragma region Clock Domains
+
+	/** Sets the time scale of a clock domain such as "UI" or "Cinematic", creating the domain if needed */
+	UFUNCTION(BlueprintCallable, Category = "Timeline")
+	void SetClockDomainTimeScale(FName DomainName, float TimeScale);
+
+	UFUNCTION(BlueprintPure, Category = "Timeline")
+	float GetClockDomainTimeScale(FName DomainName) const;
+
+	/** Pauses or resumes every timeline subscribed to the clock domain */
+	UFUNCTION(BlueprintCallable, Category = "Timeline")
+	void SetClockDomainPaused(FName DomainName, bool bPaused);
+
+	UFUNCTION(BlueprintPure, Category = "Timeline")
+	bool IsClockDomainPaused(FName DomainName) const;
+
+	/** Makes every timeline subscribed to the clock domain ignore world time dilation */
+	UFUNCTION(BlueprintCallable, Category = "Timeline")
+	void SetClockDomainIgnoreTimeDilation(FName DomainName, bool bIgnoreTimeDilation);
+
+	UFUNCTION(BlueprintPure, Category = "Timeline")
+	bool GetClockDomainIgnoreTimeDilation(FName DomainName) const;
+
+	/** Returns the index of the named clock domain, creating it with default settings if needed */
+	int32 FindOrAddClockDomain(FName DomainName);
+
+#pragma endregion
+
+#pragma region UTickableWorldSubsystem Interface
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual void Deinitialize() override;
+
+#pragma endregion
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	/** Returns the bucket for the tick group, creating and registering its tick function on first use */
+	FTimelineObjectTickBucket* FindOrCreateBucket(ETickingGroup TickGroup);
+
+	/** Advances every playing timeline of the bucket */
+	void TickBucket(FTimelineObjectTickBucket& Bucket, float DeltaTime);
+
+	/** Evaluates the curve tracks of every timeline with a pending update, in parallel */
+	void EvaluatePendingTimelines();
+
+	/** Dispatches the deferred update and finished callbacks on the game thread, in advance order */
+	void DispatchPendingTimelines();
+
+	/**
+	 * Applies the clock domain, LOD and throttling, then advances the timeline if it is due.
+	 * @return false if the update was due but deferred because the frame budget is exhausted
+	 */
+	bool UpdateTimeline(UTimelineObject& Timeline, bool bRespectFrameBudget);
+
+	/** Ticks the underlying FTimeline by DeltaTime, split into fixed substeps when the timeline uses a fixed timestep */
+	void AdvanceTimeline(UTimelineObject& Timeline, float DeltaTime);
+
+	/** True once this frame's timeline updates used up ObjectTimeline.FrameBudgetMs */
+	bool IsFrameBudgetExhausted() const;
+
+	/** Recomputes per-frame values shared by all buckets, once per frame */
+	void BeginFrameIfNeeded(float DeltaTime);
+
+	/** Returns the named clock domain, or null if it was never created */
+	const FTimelineObjectClockDomain* FindClockDomain(FName DomainName) const;
+
+	/** Recomputes the domain's scaled deltas from the current frame deltas */
+	void RefreshClockDomain(FTimelineObjectClockDomain& Domain) const;
+
+	/**
+	 * Accumulates the frame delta into the timeline and decides whether it updates this frame.
+	 * @return true with the full accumulated delta in OutDeltaTime when the timeline is due
+	 */
+	static bool ConsumeUpdateDelta(UTimelineObject& Timeline, float DeltaTime, float& OutDeltaTime);
+
+	/** Clock domain the timeline is subscribed to, the default domain when its index is stale */
+	const FTimelineObjectClockDomain& GetTimelineClockDomain(const UTimelineObject& Timeline) const;
+
+	/** Re-evaluates the timeline's LOD when its staggered LOD interval elapsed. Called for every ticking timeline before any advances. */
+	void UpdateTimelineLOD(UTimelineObject& Timeline, float DeltaTime);
+
+	/** Decides the LOD from the significance callback, Significance Manager, or distance and visibility */
+	ETimelineObjectLOD EvaluateLOD(UTimelineObject& Timeline);
+
+	/** View locations of local player controllers, gathered once per frame on demand */
+	const TArray<FVector>& GetLocalViewLocations();
+
+	/** One bucket per tick group, created on demand */
+	TArray<TUniquePtr<FTimelineObjectTickBucket>> Buckets;
+
+	/** Scratch copy iterated during a bucket tick so callbacks can activate or deactivate timelines safely */
+	TArray<UTimelineObject*> TickingTimelines;
+
+	/** Dispatch queue of the current bucket tick: timelines with queued callbacks, in the order they were advanced */
+	TArray<UTimelineObject*> PendingDispatchTimelines;
+
+	/** True while the current bucket tick advances timelines, so their callbacks are queued */
+	bool bDeferDispatch = false;
+
+	/** Count of registered timelines, playing or not */
+	int32 NumRegisteredTimelines = 0;
+
+	/** Clock domains, the default domain at index 0 */
+	TArray<FTimelineObjectClockDomain> ClockDomains;
+
+	/** Dilated world delta of the current frame */
+	float FrameDeltaTime = 0.f;
+
+	/** Clamped undilated delta of the current frame */
+	float FrameUndilatedDeltaTime = 0.f;
+
+	/** Frame the shared per-frame values were computed for */
+	uint64 LastBeginFrameCounter = MAX_uint64;
+
+	/** Low-discrepancy sequence position used to stagger throttled timelines */
+	float StaggerSequence = 0.f;
+
+	/** Frame budget in cycles, 0 when unlimited */
+	uint64 FrameBudgetCycles = 0;
+
+	/** Cycles spent updating timelines this frame */
+	uint64 FrameBudgetUsedCycles = 0;
+
+	/** Updates deferred by the frame budget this frame */
+	int32 NumDeferredUpdates = 0;
+
+	/** Cached local viewpoints for distance LOD */
+	TArray<FVector> LocalViewLocations;
+
+	/** Frame LocalViewLocations were gathered for */
+	uint64 LocalViewLocationsFrameCounter = MAX_uint64;
+};
@@ -0,0 +1,248 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TimelineObjectTracks.generated.h"
+
+class UCurveFloat;
+class UCurveVector;
+class UCurveLinearColor;
+struct FTimelineObjectBakedCurve;
+struct FTimelineObjectFusedCurve;
+
+/** Single-track listeners, bound through UTimelineObject::Bind*Track */
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnTimelineObjectFloatValue, float, Value);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnTimelineObjectVectorValue, FVector, Value);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnTimelineObjectLinearColorValue, FLinearColor, Value);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTimelineObjectFloatValueMulticast, float, Value);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTimelineObjectVectorValueMulticast, FVector, Value);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTimelineObjectLinearColorValueMulticast, FLinearColor, Value);
+
+/** Single-track native listeners, added through UTimelineObject::Add*TrackListener */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnTimelineObjectFloatValueNative, float /*Value*/);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnTimelineObjectVectorValueNative, const FVector& /*Value*/);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnTimelineObjectLinearColorValueNative, const FLinearColor& /*Value*/);
+
+/**
+ * Subscription to one curve track of a UTimelineObject. Pass it to UnbindTrack to stop listening.
+ */
+USTRUCT(BlueprintType)
+struct FTimelineObjectTrackHandle
+{
+	GENERATED_BODY()
+
+	/** Subscription id, unique within the timeline that issued it */
+	UPROPERTY()
+	int32 Id = INDEX_NONE;
+
+	bool IsValid() const { return Id != INDEX_NONE; }
+};
+
+/** Kind of curve track a subscription listens to */
+enum class ETimelineObjectTrackType : uint8
+{
+	Float,
+	Vector,
+	LinearColor
+};
+
+/**
+ * Bookkeeping behind an FTimelineObjectTrackHandle, enough to remove the listener from its track.
+ */
+struct FTimelineObjectTrackSubscription
+{
+	FName TrackName;
+
+	ETimelineObjectTrackType TrackType = ETimelineObjectTrackType::Float;
+
+	/** Set for native listeners */
+	FDelegateHandle NativeHandle;
+
+	/** Object a native listener is bound to, so RemoveAllDelegatesForObject can drop the subscription */
+	TWeakObjectPtr<const UObject> NativeOwner;
+
+	/** Set for dynamic listeners */
+	FScriptDelegate DynamicDelegate;
+};
+
+/**
+ * Key layout of a curve channel, classified when the track is registered to pick its evaluator.
+ */
+enum class ETimelineObjectCurveShape : uint8
+{
+	/** Mixed or cubic interpolation, evaluated through the key cursor */
+	General,
+
+	/** Same value at every time, evaluated once at registration */
+	Constant,
+
+	/** Two keys with linear interpolation between them, no key search */
+	TwoKeyLinear,
+
+	/** Constant interpolation on every segment */
+	Step,
+
+	/** Linear interpolation on every segment */
+	Linear
+};
+
+/**
+ * Runtime state of a float track owned by UTimelineObject.
+ * Value is written by the evaluation phase and read by the dispatch phase.
+ */
+USTRUCT()
+struct FTimelineObjectFloatTrack
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FName TrackName;
+
+	UPROPERTY()
+	TObjectPtr<UCurveFloat> Curve;
+
+	/** Curve value at the last evaluated playback position */
+	float Value = 0.f;
+
+	/** Shared lookup table evaluated instead of the curve, when baking is enabled */
+	TSharedPtr<const FTimelineObjectBakedCurve> BakedCurve;
+
+	/** Key segment of the last evaluation, INDEX_NONE forces a search */
+	int32 KeyCursor = INDEX_NONE;
+
+	/** Key layout of the curve */
+	ETimelineObjectCurveShape Shape = ETimelineObjectCurveShape::General;
+
+	/** Listeners of this track only */
+	FOnTimelineObjectFloatValueNative NativeSubscribers;
+	FOnTimelineObjectFloatValueMulticast DynamicSubscribers;
+
+	/** Blueprint pins reading this track, registered when the timeline is created from its template */
+	int32 PinReaders = 0;
+
+	/** Whether a getter read this track since the last evaluation, which keeps it evaluated for the next one */
+	mutable bool bReadByGetter = false;
+
+	/** Whether the last evaluation skipped this track because nothing observed it, leaving Value stale */
+	bool bSkipped = false;
+};
+
+/**
+ * Runtime state of a vector track owned by UTimelineObject.
+ */
+USTRUCT()
+struct FTimelineObjectVectorTrack
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FName TrackName;
+
+	UPROPERTY()
+	TObjectPtr<UCurveVector> Curve;
+
+	/** Curve value at the last evaluated playback position */
+	FVector Value = FVector::ZeroVector;
+
+	/** Shared lookup table evaluated instead of the curve, when baking is enabled */
+	TSharedPtr<const FTimelineObjectBakedCurve> BakedCurve;
+
+	/** Key segment of the last evaluation per channel, INDEX_NONE forces a search */
+	int32 KeyCursors[3] = { INDEX_NONE, INDEX_NONE, INDEX_NONE };
+
+	/** Key layout of each channel */
+	ETimelineObjectCurveShape Shapes[3] = { ETimelineObjectCurveShape::General, ETimelineObjectCurveShape::General, ETimelineObjectCurveShape::General };
+
+	/** Whether every channel is constant, so Value is set once at registration */
+	bool bConstant = false;
+
+	/** Listeners of this track only */
+	FOnTimelineObjectVectorValueNative NativeSubscribers;
+	FOnTimelineObjectVectorValueMulticast DynamicSubscribers;
+
+	/** Blueprint pins reading this track, registered when the timeline is created from its template */
+	int32 PinReaders = 0;
+
+	/** Whether a getter read this track since the last evaluation, which keeps it evaluated for the next one */
+	mutable bool bReadByGetter = false;
+
+	/** Whether the last evaluation skipped this track because nothing observed it, leaving Value stale */
+	bool bSkipped = false;
+
+	/** Shared grid evaluating all channels at once, when the curve supports it */
+	TSharedPtr<const FTimelineObjectFusedCurve> FusedCurve;
+
+	/** Grid segment of the last fused evaluation */
+	int32 FusedCursor = INDEX_NONE;
+};
+
+/**
+ * Runtime state of a linear color track owned by UTimelineObject.
+ */
+USTRUCT()
+struct FTimelineObjectLinearColorTrack
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FName TrackName;
+
+	UPROPERTY()
+	TObjectPtr<UCurveLinearColor> Curve;
+
+	/** Curve value at the last evaluated playback position */
+	FLinearColor Value = FLinearColor::Black;
+
+	/** Shared lookup table evaluated instead of the curve, when baking is enabled */
+	TSharedPtr<const FTimelineObjectBakedCurve> BakedCurve;
+
+	/** Shared grid evaluating all channels at once, when the curve supports it */
+	TSharedPtr<const FTimelineObjectFusedCurve> FusedCurve;
+
+	/** Grid segment of the last fused evaluation */
+	int32 FusedCursor = INDEX_NONE;
+
+	/** Whether every channel is constant, so Value is set once at registration */
+	bool bConstant = false;
+
+	/** Listeners of this track only */
+	FOnTimelineObjectLinearColorValueNative NativeSubscribers;
+	FOnTimelineObjectLinearColorValueMulticast DynamicSubscribers;
+
+	/** Blueprint pins reading this track, registered when the timeline is created from its template */
+	int32 PinReaders = 0;
+
+	/** Whether a getter read this track since the last evaluation, which keeps it evaluated for the next one */
+	mutable bool bReadByGetter = false;
+
+	/** Whether the last evaluation skipped this track because nothing observed it, leaving Value stale */
+	bool bSkipped = false;
+};
+
+/**
+ * Event track owned by UTimelineObject. Its keys are compiled into the timeline's event schedule.
+ */
+USTRUCT()
+struct FTimelineObjectEventTrack
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FName TrackName;
+
+	UPROPERTY()
+	TObjectPtr<UCurveFloat> Curve;
+};
+
+/**
+ * Entry of the merged event schedule of UTimelineObject: one event track key or one event added with AddEvent.
+ */
+struct FTimelineObjectScheduledEvent
+{
+	float Time = 0.f;
+
+	/** Index of the event track the key belongs to, INDEX_NONE for added events */
+	int32 TrackIndex = INDEX_NONE;
+
+	/** Index of the added event, INDEX_NONE for event track keys */
+	int32 AddedEventIndex = INDEX_NONE;
+};
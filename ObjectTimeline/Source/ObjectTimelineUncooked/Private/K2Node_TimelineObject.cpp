@@ -696,9 +696,31 @@ void UK2Node_TimelineObject::RegisterDynamicBinding(UDynamicBlueprintBinding* Bi
 				Entry.EventTrackFunctionNames.Add(EventTrack.GetTrackName(), EventTrackFuncName);
 			}
 		}
+
+		// Connected track pins read their values through the getters, which the timeline must keep evaluating
+		auto AddReadTrack = [this, &Entry](FName TrackName)
+		{
+			UEdGraphPin* TrackPin = FindPin(TrackName, EGPD_Output);
+			if (TrackPin && TrackPin->LinkedTo.Num() > 0)
+			{
+				Entry.ReadTrackNames.Add(TrackName);
+			}
+		};
+		for (const FTTFloatTrack& FloatTrack : Timeline->FloatTracks)
+		{
+			AddReadTrack(FloatTrack.GetTrackName());
+		}
+		for (const FTTVectorTrack& VectorTrack : Timeline->VectorTracks)
+		{
+			AddReadTrack(VectorTrack.GetTrackName());
+		}
+		for (const FTTLinearColorTrack& ColorTrack : Timeline->LinearColorTracks)
+		{
+			AddReadTrack(ColorTrack.GetTrackName());
+		}
 	}
 
-	if (Entry.EventTrackFunctionNames.Num() > 0)
+	if (Entry.EventTrackFunctionNames.Num() > 0 || Entry.ReadTrackNames.Num() > 0)
 	{
 		TimelineBinding->TimelineBindings.Add(Entry);
 	}